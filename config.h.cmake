@@ -5,6 +5,10 @@
 
 #cmakedefine ENABLE_SQDBG
 
+#cmakedefine ENABLE_SQUIRREL_POOL
+
+#cmakedefine BUILD_TESTS
+
 #cmakedefine ENABLE_BINRELOC
 #define INSTALL_SUBDIR_BIN "${INSTALL_SUBDIR_BIN}"
 #define INSTALL_SUBDIR_SHARE "${INSTALL_SUBDIR_SHARE}"
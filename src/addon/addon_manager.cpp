@@ -116,6 +116,7 @@ static PHYSFS_EnumerateCallbackResult add_to_dictionary_path(void *data, const c
         log_debug << "Adding \"" << full_path << "\" to dictionary search path" << std::endl;
         // We want translations from addons to have precedence
         g_dictionary_manager->add_directory(full_path, true);
+        invalidate_translations();
     }
     return PHYSFS_ENUM_OK;
 }
@@ -126,6 +127,7 @@ static PHYSFS_EnumerateCallbackResult remove_from_dictionary_path(void *data, co
     if (physfsutil::is_directory(full_path))
     {
         g_dictionary_manager->remove_directory(full_path);
+        invalidate_translations();
     }
     return PHYSFS_ENUM_OK;
 }
@@ -327,49 +327,60 @@ BadGuy::collision(GameObject& other, const CollisionHit& hit)
 {
   if (!is_active()) return ABORT_MOVE;
 
-  auto badguy = dynamic_cast<BadGuy*> (&other);
-  if (badguy && badguy->is_active() && badguy->m_col.get_group() == COLGROUP_MOVING) {
+  // only MovingObjects take part in collisions, their kind was
+  // resolved when they were added to the CollisionSystem
+  const CollisionObject& other_col = *static_cast<MovingObject&>(other).get_collision_object();
+  switch (other_col.get_kind())
+  {
+    case COLKIND_BADGUY:
+    {
+      auto& badguy = static_cast<BadGuy&>(other);
+      if (badguy.is_active() && other_col.get_group() == COLGROUP_MOVING) {
 
-    /* Badguys don't let badguys squish other badguys. It's bad. */
+        /* Badguys don't let badguys squish other badguys. It's bad. */
 #if 0
-    // hit from above?
-    if (badguy->get_bbox().get_bottom() < (bbox.get_top() + 16)) {
-      if (collision_squished(*badguy)) {
-        return ABORT_MOVE;
-      }
-    }
+        // hit from above?
+        if (badguy.get_bbox().get_bottom() < (bbox.get_top() + 16)) {
+          if (collision_squished(badguy)) {
+            return ABORT_MOVE;
+          }
+        }
 #endif
 
-    return collision_badguy(*badguy, hit);
-  }
+        return collision_badguy(badguy, hit);
+      }
+      return FORCE_MOVE;
+    }
 
-  auto player = dynamic_cast<Player*> (&other);
-  if (player) {
+    case COLKIND_PLAYER:
+    {
+      auto& player = static_cast<Player&>(other);
 
-    // hit from above?
-    if (player->get_bbox().get_bottom() < (m_col.m_bbox.get_top() + 16)) {
-      if (player->is_stone()) {
-        kill_fall();
-        return FORCE_MOVE;
+      // hit from above?
+      if (player.get_bbox().get_bottom() < (m_col.m_bbox.get_top() + 16)) {
+        if (player.is_stone()) {
+          kill_fall();
+          return FORCE_MOVE;
+        }
+        if (collision_squished(player)) {
+          return FORCE_MOVE;
+        }
       }
-      if (collision_squished(*player)) {
+
+      if (player.is_stone()) {
+        collision_solid(hit);
         return FORCE_MOVE;
       }
-    }
 
-    if (player->is_stone()) {
-      collision_solid(hit);
-      return FORCE_MOVE;
+      return collision_player(player, hit);
     }
 
-    return collision_player(*player, hit);
-  }
-
-  auto bullet = dynamic_cast<Bullet*> (&other);
-  if (bullet)
-    return collision_bullet(*bullet, hit);
+    case COLKIND_BULLET:
+      return collision_bullet(static_cast<Bullet&>(other), hit);
 
-  return FORCE_MOVE;
+    default:
+      return FORCE_MOVE;
+  }
 }
 
 void
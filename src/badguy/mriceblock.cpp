@@ -37,6 +37,7 @@ MrIceBlock::MrIceBlock(const ReaderMapping& reader) :
 {
   walk_speed = 80;
   max_drop_height = 600;
+  m_col.set_fast(true);
   SoundManager::current()->preload("sounds/iceblock_bump.wav");
   SoundManager::current()->preload("sounds/stomp.wav");
   SoundManager::current()->preload("sounds/kick.wav");
@@ -17,6 +17,8 @@
 #include "collision/collision.hpp"
 
 #include <algorithm>
+#include <cmath>
+#include <limits>
 
 #include "math/aatriangle.hpp"
 #include "math/rectf.hpp"
@@ -224,6 +226,73 @@ bool intersects_line(const Rectf& r, const Vector& line_start, const Vector& lin
   return false;
 }
 
+namespace {
+
+/** Gap up to which two rectangles count as touching, this covers the
+    small distance the collision response leaves between an object and
+    the surface it rests on */
+const float SWEEP_CONTACT = 0.01f;
+
+/** Sweeps [rect_min, rect_max] along one axis towards [other_min,
+    other_max]. Returns false if rect can't run into other on this
+    axis, otherwise fills in the fractions of movement at which the
+    two intervals start and stop overlapping. */
+bool sweep_axis(float rect_min, float rect_max, float movement,
+                float other_min, float other_max,
+                float& entry, float& exit)
+{
+  if (movement == 0.0f) {
+    // moving parallel to other, touching doesn't count
+    if (rect_max <= other_min + SWEEP_CONTACT || rect_min >= other_max - SWEEP_CONTACT)
+      return false;
+    entry = -std::numeric_limits<float>::infinity();
+    exit = std::numeric_limits<float>::infinity();
+    return true;
+  }
+
+  const float gap = (movement > 0.0f) ? other_min - rect_max : rect_min - other_max;
+  const float behind = (movement > 0.0f) ? rect_min - other_max : other_min - rect_max;
+
+  // touching the side of other that rect moves away from
+  if (std::abs(behind) <= SWEEP_CONTACT)
+    return false;
+
+  if (std::abs(gap) <= SWEEP_CONTACT) {
+    // already touching the side rect moves towards: a resting contact
+    // the discrete collision detection resolves, unless the movement
+    // is long enough to carry rect through other
+    if (std::abs(movement) < other_max - other_min)
+      return false;
+    entry = 0.0f;
+  } else {
+    entry = gap / std::abs(movement);
+  }
+  exit = (gap + (rect_max - rect_min) + (other_max - other_min)) / std::abs(movement);
+  return true;
+}
+
+} // namespace
+
+float sweep(const Rectf& rect, const Vector& movement, const Rectf& other)
+{
+  float entry_x, exit_x;
+  if (!sweep_axis(rect.get_left(), rect.get_right(), movement.x,
+                  other.get_left(), other.get_right(), entry_x, exit_x))
+    return 1.0f;
+
+  float entry_y, exit_y;
+  if (!sweep_axis(rect.get_top(), rect.get_bottom(), movement.y,
+                  other.get_top(), other.get_bottom(), entry_y, exit_y))
+    return 1.0f;
+
+  const float entry = std::max(entry_x, entry_y);
+  const float exit = std::min(exit_x, exit_y);
+  if (entry > exit || entry < 0.0f || entry >= 1.0f)
+    return 1.0f;
+
+  return entry;
+}
+
 }
 
 /* EOF */
@@ -135,6 +135,14 @@ void set_rectangle_rectangle_constraints(Constraints* constraints,
 bool line_intersects_line(const Vector& line1_start, const Vector& line1_end, const Vector& line2_start, const Vector& line2_end);
 bool intersects_line(const Rectf& r, const Vector& line_start, const Vector& line_end);
 
+/** Returns the fraction of movement after which rect first runs into
+    other, or 1.0 if it doesn't at all. Rectangles that already
+    overlap return 1.0, as do rectangles that touch and move parallel
+    to or away from each other. Moving into a touching rectangle
+    returns 0.0 only if the movement could carry rect through it,
+    shorter moves are left to the discrete collision detection. */
+float sweep(const Rectf& rect, const Vector& movement, const Rectf& other);
+
 } // namespace collision
 
 #endif
@@ -22,6 +22,9 @@
 
 CollisionObject::CollisionObject(CollisionGroup group, CollisionListener& listener) :
   m_listener(listener),
+  m_game_object(nullptr),
+  m_kind(COLKIND_OTHER),
+  m_fast(false),
   m_bbox(),
   m_movement(),
   m_group(group),
@@ -38,13 +41,13 @@ CollisionObject::collision_solid(const CollisionHit& hit)
 bool
 CollisionObject::collides(CollisionObject& other, const CollisionHit& hit) const
 {
-  return m_listener.collides(dynamic_cast<GameObject&>(other.m_listener), hit);
+  return m_listener.collides(other.get_game_object(), hit);
 }
 
 HitResponse
 CollisionObject::collision(CollisionObject& other, const CollisionHit& hit)
 {
-  return m_listener.collision(dynamic_cast<GameObject&>(other.m_listener), hit);
+  return m_listener.collision(other.get_game_object(), hit);
 }
 
 void
@@ -53,6 +56,15 @@ CollisionObject::collision_tile(uint32_t tile_attributes)
   m_listener.collision_tile(tile_attributes);
 }
 
+GameObject&
+CollisionObject::get_game_object() const
+{
+  if (m_game_object)
+    return *m_game_object;
+
+  return dynamic_cast<GameObject&>(m_listener);
+}
+
 bool
 CollisionObject::is_valid() const
 {
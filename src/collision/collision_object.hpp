@@ -27,6 +27,17 @@
 class CollisionListener;
 class GameObject;
 
+/** Kind of the object behind a CollisionObject. It is resolved once
+    when the object is added to the CollisionSystem, so collision
+    responses can dispatch on it instead of doing dynamic_casts for
+    every pair. */
+enum CollisionObjectKind {
+  COLKIND_OTHER,
+  COLKIND_PLAYER,
+  COLKIND_BADGUY,
+  COLKIND_BULLET
+};
+
 class CollisionObject
 {
   friend class CollisionSystem;
@@ -104,6 +115,24 @@ public:
     return m_group;
   }
 
+  CollisionObjectKind get_kind() const
+  {
+    return m_kind;
+  }
+
+  /** Fast objects are not slowed down to the speed limit of the
+      CollisionSystem, their movement is swept against tiles and
+      static objects instead, so they can't tunnel through them */
+  void set_fast(bool fast)
+  {
+    m_fast = fast;
+  }
+
+  bool is_fast() const
+  {
+    return m_fast;
+  }
+
   bool is_valid() const;
 
   CollisionListener& get_listener()
@@ -111,9 +140,18 @@ public:
     return m_listener;
   }
 
+private:
+  GameObject& get_game_object() const;
+
 private:
   CollisionListener& m_listener;
 
+  /** The listener as GameObject and its kind, set by CollisionSystem::add() */
+  GameObject* m_game_object;
+  CollisionObjectKind m_kind;
+
+  bool m_fast;
+
 public:
   /** The bounding box of the object (as used for collision detection,
       this isn't necessarily the bounding box for graphics) */
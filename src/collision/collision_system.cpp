@@ -17,13 +17,16 @@
 
 #include "collision/collision_system.hpp"
 
+#include "badguy/badguy.hpp"
 #include "collision/collision.hpp"
 #include "editor/editor.hpp"
 #include "math/aatriangle.hpp"
 #include "math/rect.hpp"
+#include "object/bullet.hpp"
 #include "object/player.hpp"
 #include "object/tilemap.hpp"
 #include "supertux/constants.hpp"
+#include "supertux/resources.hpp"
 #include "supertux/sector.hpp"
 #include "supertux/tile.hpp"
 #include "video/color.hpp"
@@ -36,17 +39,38 @@ const float MAX_SPEED = 16.0f;
 // a small value... be careful as CD is very sensitive to it
 const float DELTA = .002f;
 
+/** How far a fast object is moved past the point where its sweep
+    first touches a solid, so the regular collision detection sees
+    the contact */
+const float SWEEP_OVERLAP = 1.0f;
+
+CollisionObjectKind get_collision_kind(GameObject& object)
+{
+  if (dynamic_cast<Player*>(&object))
+    return COLKIND_PLAYER;
+  else if (dynamic_cast<BadGuy*>(&object))
+    return COLKIND_BADGUY;
+  else if (dynamic_cast<Bullet*>(&object))
+    return COLKIND_BULLET;
+  else
+    return COLKIND_OTHER;
+}
+
 } // namespace
 
 CollisionSystem::CollisionSystem(Sector& sector) :
   m_sector(sector),
-  m_objects()
+  m_objects(),
+  m_pair_count(0)
 {
 }
 
 void
 CollisionSystem::add(CollisionObject* object)
 {
+  object->m_game_object = &dynamic_cast<GameObject&>(object->m_listener);
+  object->m_kind = get_collision_kind(*object->m_game_object);
+
   m_objects.push_back(object);
 }
 
@@ -68,6 +92,14 @@ CollisionSystem::draw(DrawingContext& context)
 
     context.color().draw_filled_rect(rect, color, LAYER_FOREGROUND1 + 10);
   }
+
+  context.push_transform();
+  context.set_translation(Vector(0, 0));
+  context.color().draw_text(Resources::small_font,
+                            "Collision pairs: " + std::to_string(m_pair_count),
+                            Vector(10.0f, static_cast<float>(context.get_height()) - 30.0f),
+                            ALIGN_LEFT, LAYER_HUD);
+  context.pop_transform();
 }
 
 namespace {
@@ -274,7 +306,7 @@ static void get_hit_normal(const Rectf& r1, const Rectf& r2, CollisionHit& hit,
 }
 
 void
-CollisionSystem::collision_object(CollisionObject* object1, CollisionObject* object2) const
+CollisionSystem::collision_object(CollisionObject* object1, CollisionObject* object2)
 {
   using namespace collision;
 
@@ -295,6 +327,7 @@ CollisionSystem::collision_object(CollisionObject* object1, CollisionObject* obj
     std::swap(hit.left, hit.right);
     std::swap(hit.top, hit.bottom);
 
+    m_pair_count += 1;
     HitResponse response1 = object1->collision(*object2, hit);
     std::swap(hit.left, hit.right);
     std::swap(hit.top, hit.bottom);
@@ -336,6 +369,71 @@ CollisionSystem::collision_static(collision::Constraints* constraints,
   }
 }
 
+Vector
+CollisionSystem::sweep_movement(CollisionObject& object) const
+{
+  const Vector& movement = object.get_movement();
+  const float length = movement.norm();
+  if (length <= MAX_SPEED)
+    return movement;
+
+  const Rectf& bbox = object.get_bbox();
+  Rectf swept_rect = bbox;
+  swept_rect.move(movement);
+  swept_rect = Rectf(std::min(bbox.get_left(), swept_rect.get_left()),
+                     std::min(bbox.get_top(), swept_rect.get_top()),
+                     std::max(bbox.get_right(), swept_rect.get_right()),
+                     std::max(bbox.get_bottom(), swept_rect.get_bottom()));
+
+  float time = 1.0f;
+
+  for (const auto& solids : m_sector.get_solid_tilemaps())
+  {
+    const Rect test_tiles = solids->get_tiles_overlapping(swept_rect);
+    for (int x = test_tiles.left; x < test_tiles.right; ++x)
+    {
+      for (int y = test_tiles.top; y < test_tiles.bottom; ++y)
+      {
+        const Tile& tile = solids->get_tile(x, y);
+        if (!tile.is_solid())
+          continue;
+
+        const Rectf tile_bbox = solids->get_tile_bbox(x, y);
+        if (tile.is_unisolid()) {
+          const Vector relative_movement = movement - solids->get_movement(/* actual = */ true);
+          if (!tile.is_solid(tile_bbox, bbox, relative_movement))
+            continue;
+        }
+
+        // slopes are swept like full tiles, the regular collision
+        // detection takes over once the object reached their bbox
+        time = std::min(time, collision::sweep(bbox, movement, tile_bbox));
+      }
+    }
+  }
+
+  const CollisionHit dummy;
+  for (const auto& static_object : m_objects)
+  {
+    if (static_object->get_group() != COLGROUP_STATIC &&
+        static_object->get_group() != COLGROUP_MOVING_STATIC)
+      continue;
+    if (static_object == &object || !static_object->is_valid())
+      continue;
+    if (!collision::intersects(swept_rect, static_object->m_bbox))
+      continue;
+    if (!static_object->collides(object, dummy) || !object.collides(*static_object, dummy))
+      continue;
+
+    time = std::min(time, collision::sweep(bbox, movement, static_object->m_bbox));
+  }
+
+  if (time >= 1.0f)
+    return movement;
+
+  return movement * (std::min(time * length + SWEEP_OVERLAP, length) / length);
+}
+
 void
 CollisionSystem::collision_static_constrains(CollisionObject& object)
 {
@@ -465,13 +563,24 @@ CollisionSystem::update()
 
   using namespace collision;
 
+  m_pair_count = 0;
+
   // calculate destination positions of the objects
   for (const auto& object : m_objects)
   {
     const Vector mov = object->get_movement();
 
+    if (object->is_fast()) {
+      // fast objects aren't slowed down, but stopped at the first solid in their way
+      if ((object->get_group() == COLGROUP_MOVING ||
+           object->get_group() == COLGROUP_MOVING_STATIC ||
+           object->get_group() == COLGROUP_MOVING_ONLY_STATIC) &&
+          object->is_valid()) {
+        object->m_movement = sweep_movement(*object);
+      }
+    }
     // make sure movement is never faster than MAX_SPEED. Norm is pretty fat, so two addl. checks are done before.
-    if (((mov.x > MAX_SPEED * static_cast<float>(M_SQRT1_2)) || (mov.y > MAX_SPEED * static_cast<float>(M_SQRT1_2))) && (mov.norm() > MAX_SPEED)) {
+    else if (((mov.x > MAX_SPEED * static_cast<float>(M_SQRT1_2)) || (mov.y > MAX_SPEED * static_cast<float>(M_SQRT1_2))) && (mov.norm() > MAX_SPEED)) {
       object->m_movement = mov.unit() * MAX_SPEED;
       //log_debug << "Temporarily reduced object's speed of " << mov.norm() << " to " << object->movement.norm() << "." << std::endl;
     }
@@ -528,6 +637,7 @@ CollisionSystem::update()
         if (!object_2->collides(*object, hit))
           continue;
 
+        m_pair_count += 1;
         object->collision(*object_2, hit);
         object_2->collision(*object, hit);
       }
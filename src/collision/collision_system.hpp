@@ -52,6 +52,10 @@ public:
 
   std::vector<CollisionObject*> get_nearby_objects(const Vector& center, float max_distance) const;
 
+  /** Number of object pairs whose collision responses were called in
+      the last update() */
+  int get_pair_count() const { return m_pair_count; }
+
 private:
   /** Does collision detection of an object against all other static
       objects (and the tilemap) in the level. Collision response is
@@ -71,13 +75,18 @@ private:
 
   uint32_t collision_tile_attributes(const Rectf& dest, const Vector& mov) const;
 
-  void collision_object(CollisionObject* object1, CollisionObject* object2) const;
+  void collision_object(CollisionObject* object1, CollisionObject* object2);
 
   void collision_static_constrains(CollisionObject& object);
 
+  /** Returns the movement of a fast object, cut off just past the
+      first tile or static object its bbox would touch on the way */
+  Vector sweep_movement(CollisionObject& object) const;
+
 private:
   Sector& m_sector;
   std::vector<CollisionObject*>  m_objects;
+  int m_pair_count;
 
 private:
   CollisionSystem(const CollisionSystem&) = delete;
@@ -55,7 +55,7 @@ ItemColorChannel::draw(DrawingContext& context, const Vector& pos, int menu_widt
 int
 ItemColorChannel::get_width() const
 {
-  return static_cast<int>(Resources::normal_font->get_text_width(get_text()) + 16 + static_cast<float>(m_flickw));
+  return static_cast<int>(get_text_width() + 16 + static_cast<float>(m_flickw));
 }
 
 void
@@ -41,7 +41,7 @@ ItemControlField::draw(DrawingContext& context, const Vector& pos, int menu_widt
 
 int
 ItemControlField::get_width() const {
-  return static_cast<int>(Resources::normal_font->get_text_width(get_text()) + Resources::normal_font->get_text_width(input) + 16.0f);
+  return static_cast<int>(get_text_width() + Resources::normal_font->get_text_width(input) + 16.0f);
 }
 
 /* EOF */
@@ -48,7 +48,7 @@ ItemIntField::draw(DrawingContext& context, const Vector& pos, int menu_width, b
 
 int
 ItemIntField::get_width() const {
-  return static_cast<int>(Resources::normal_font->get_text_width(get_text()) + Resources::normal_font->get_text_width(input)) + 16 + flickw;
+  return static_cast<int>(get_text_width() + Resources::normal_font->get_text_width(input)) + 16 + flickw;
 }
 
 void
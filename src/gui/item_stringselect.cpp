@@ -57,7 +57,7 @@ ItemStringSelect::draw(DrawingContext& context, const Vector& pos, int menu_widt
 
 int
 ItemStringSelect::get_width() const {
-  return static_cast<int>(Resources::normal_font->get_text_width(get_text()) + Resources::normal_font->get_text_width(list[*selected])) + 64;
+  return static_cast<int>(get_text_width() + Resources::normal_font->get_text_width(list[*selected])) + 64;
 }
 
 void
@@ -47,7 +47,7 @@ ItemTextField::draw(DrawingContext& context, const Vector& pos, int menu_width,
 
 int
 ItemTextField::get_width() const {
-  return static_cast<int>(Resources::normal_font->get_text_width(get_text()) + Resources::normal_font->get_text_width(*input) + 16.0f + static_cast<float>(flickw));
+  return static_cast<int>(get_text_width() + Resources::normal_font->get_text_width(*input) + 16.0f + static_cast<float>(flickw));
 }
 
 void
@@ -61,7 +61,7 @@ ItemToggle::draw(DrawingContext& context, const Vector& pos, int menu_width, boo
 int
 ItemToggle::get_width() const
 {
-  return static_cast<int>(Resources::normal_font->get_text_width(get_text())) + 16 + Resources::checkbox->get_width();
+  return static_cast<int>(get_text_width()) + 16 + Resources::checkbox->get_width();
 }
 
 void
@@ -16,6 +16,8 @@
 
 #include "gui/menu.hpp"
 
+#include <algorithm>
+
 #include "control/input_manager.hpp"
 #include "gui/item_action.hpp"
 #include "gui/item_back.hpp"
@@ -59,6 +61,7 @@ Menu::Menu() :
   m_menu_width(),
   m_items(),
   m_arrange_left(0),
+  m_next_load_item(0),
   m_active_item(-1)
 {
 }
@@ -91,7 +94,9 @@ Menu::add_item(std::unique_ptr<MenuItem> new_item)
     m_active_item = static_cast<int>(m_items.size()) - 1;
   }
 
-  calculate_width();
+  // Only measure the new item, recalculating the whole width here
+  // would make filling long menus quadratic in font measurements
+  fit_width(item);
 
   return item;
 }
@@ -110,7 +115,7 @@ Menu::add_item(std::unique_ptr<MenuItem> new_item, int pos_)
     m_active_item++;
   }
 
-  calculate_width();
+  fit_width(item);
 
   return item;
 }
@@ -132,6 +137,9 @@ Menu::delete_item(int pos_)
         m_active_item = int(m_items.size())-1;
     } while (m_items[m_active_item]->skippable());
   }
+
+  // The deleted item might have been the widest one
+  calculate_width();
 }
 
 ItemHorizontalLine&
@@ -328,6 +336,8 @@ Menu::clear()
 {
   m_items.clear();
   m_active_item = -1;
+  m_menu_width = 0.0f;
+  m_next_load_item = 0;
 }
 
 void
@@ -382,6 +392,8 @@ Menu::process_input(const Controller& controller)
     }
   }
 
+  load_items();
+
   MenuAction menuaction = MenuAction::NONE;
 
   /** check main input controller... */
@@ -551,6 +563,51 @@ Menu::calculate_width()
   m_menu_width = max_width;
 }
 
+void
+Menu::load_items()
+{
+  // Items on screen are loaded right away, the others a few per frame
+  // so that the menu is complete shortly after it was opened
+  static const int BACKGROUND_ITEMS_PER_FRAME = 4;
+
+  bool changed = false;
+
+  int first_item;
+  int last_item;
+  get_visible_range(static_cast<float>(SCREEN_HEIGHT), first_item, last_item);
+  for (int i = first_item; i < last_item; ++i)
+  {
+    changed |= load_item(*m_items[i]);
+  }
+
+  for (int i = 0; i < BACKGROUND_ITEMS_PER_FRAME && m_next_load_item < m_items.size(); ++i)
+  {
+    changed |= load_item(*m_items[m_next_load_item]);
+    ++m_next_load_item;
+  }
+
+  if (changed)
+  {
+    calculate_width();
+  }
+}
+
+void
+Menu::get_visible_range(float view_height, int& first_item, int& last_item) const
+{
+  // Long menus are scrolled by moving m_pos
+  const float menu_top = m_pos.y - get_height() / 2.0f;
+  first_item = std::max(0, static_cast<int>(floorf(-menu_top / 24.0f)) - 1);
+  last_item = std::min(static_cast<int>(m_items.size()),
+                       static_cast<int>(ceilf((view_height - menu_top) / 24.0f)) + 1);
+}
+
+void
+Menu::fit_width(const MenuItem& item)
+{
+  m_menu_width = std::max(m_menu_width, static_cast<float>(item.get_width()));
+}
+
 float
 Menu::get_width() const
 {
@@ -573,7 +630,11 @@ Menu::on_window_resize()
 void
 Menu::draw(DrawingContext& context)
 {
-  for (unsigned int i = 0; i < m_items.size(); ++i)
+  // Only the items that actually end up on screen get drawn
+  int first_item;
+  int last_item;
+  get_visible_range(static_cast<float>(context.get_height()), first_item, last_item);
+  for (int i = first_item; i < last_item; ++i)
   {
     draw_item(context, i);
   }
@@ -65,6 +65,12 @@ public:
 
   virtual void on_window_resize();
 
+  /** Called by process_input() to fill in expensive entries lazily,
+      first for the items on screen, then a few per frame for the
+      rest, so that every item is loaded at most once and never from
+      draw(). Returns true when the item's text changed. */
+  virtual bool load_item(MenuItem& item) { return false; }
+
   ItemHorizontalLine& add_hl();
   ItemLabel& add_label(const std::string& text);
   ItemAction& add_entry(int id, const std::string& text);
@@ -121,12 +127,19 @@ protected:
   MenuItem& add_item(std::unique_ptr<MenuItem> menu_item, int pos_);
   void delete_item(int pos_);
 
+  /** Recalculates the width for this menu, cheap as the items cache
+      the width of their text */
+  void calculate_width();
+
 private:
   void process_action(const MenuAction& menuaction);
   void check_controlfield_change_event(const SDL_Event& event);
   void draw_item(DrawingContext& context, int index);
-  /** Recalculates the width for this menu */
-  void calculate_width();
+  /** Widens the menu if the given new item doesn't fit */
+  void fit_width(const MenuItem& item);
+  void load_items();
+  /** Returns the range of items that fit on a screen of the given height */
+  void get_visible_range(float view_height, int& first_item, int& last_item) const;
 
 private:
   /** position of the menu (ie. center of the menu, not top/left) */
@@ -144,6 +157,9 @@ public:
 private:
   int m_arrange_left;
 
+  /** Next item load_items() passes to load_item() in the background */
+  size_t m_next_load_item;
+
 protected:
   int m_active_item;
 
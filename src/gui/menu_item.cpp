@@ -26,6 +26,7 @@
 MenuItem::MenuItem(const std::string& text, int id) :
   m_id(id),
   m_text(text),
+  m_text_width(-1.0f),
   m_help()
 {
 }
@@ -60,9 +61,19 @@ MenuItem::get_color() const {
   return ColorScheme::Menu::default_color;
 }
 
+float
+MenuItem::get_text_width() const
+{
+  if (m_text_width < 0.0f)
+  {
+    m_text_width = Resources::normal_font->get_text_width(m_text);
+  }
+  return m_text_width;
+}
+
 int
 MenuItem::get_width() const {
-  return static_cast<int>(Resources::normal_font->get_text_width(m_text)) + 16;
+  return static_cast<int>(get_text_width()) + 16;
 }
 
 /* EOF */
@@ -31,9 +31,14 @@ public:
   void set_help(const std::string& help_text);
   const std::string& get_help() const { return m_help; }
 
-  void set_text(const std::string& text) { m_text = text; }
+  void set_text(const std::string& text) { m_text = text; m_text_width = -1.0f; }
   const std::string& get_text() const { return m_text; }
 
+  /** Returns the width of the text in the normal font, measured once
+      per set_text() as get_width() is queried for every item whenever
+      the menu width is recalculated */
+  float get_text_width() const;
+
   /** Draws the menu item. */
   virtual void draw(DrawingContext&, const Vector& pos, int menu_width, bool active);
 
@@ -68,6 +73,7 @@ public:
 private:
   int m_id;
   std::string m_text;
+  mutable float m_text_width;
   std::string m_help;
 
 private:
@@ -16,14 +16,37 @@
 
 #include "object/background.hpp"
 
+#include <algorithm>
+
 #include "editor/editor.hpp"
 #include "supertux/d_scope.hpp"
 #include "supertux/globals.hpp"
 #include "util/reader.hpp"
 #include "util/reader_mapping.hpp"
 #include "util/writer.hpp"
+#include "util/string_util.hpp"
 #include "video/drawing_context.hpp"
 #include "video/surface.hpp"
+#include "video/texture_manager.hpp"
+
+namespace {
+
+/** Plain images are loaded with a repeating sampler, so that they can
+    be tiled across the screen with a single quad */
+SurfacePtr load_image(const std::string& filename)
+{
+  if (StringUtil::has_suffix(filename, ".surface"))
+  {
+    return Surface::from_file(filename);
+  }
+  else
+  {
+    const Sampler sampler(GL_LINEAR, GL_REPEAT, GL_REPEAT, Vector(0.0f, 0.0f));
+    return Surface::from_texture(TextureManager::current()->get(filename, boost::none, sampler));
+  }
+}
+
+} // namespace
 
 Background::Background() :
   ExposedObject<Background, scripting::Background>(this),
@@ -116,7 +139,7 @@ Background::Background(const ReaderMapping& reader) :
   m_layer = reader_get_layer(reader, LAYER_BACKGROUND0);
 
   reader.get("image", m_imagefile, "images/background/transparent_up.png");
-  m_image = Surface::from_file(m_imagefile);
+  m_image = load_image(m_imagefile);
 
   if(!reader.get("speed-x", m_parallax_speed.x))
   {
@@ -127,7 +150,7 @@ Background::Background(const ReaderMapping& reader) :
   reader.get("speed-y", m_parallax_speed.y, m_parallax_speed.x);
 
   if (reader.get("image-top", m_imagefile_top)) {
-    m_image_top = Surface::from_file(m_imagefile_top);
+    m_image_top = load_image(m_imagefile_top);
   } else {
     if (!Editor::is_active()) {
       m_imagefile_top = m_imagefile;
@@ -135,7 +158,7 @@ Background::Background(const ReaderMapping& reader) :
   }
 
   if (reader.get("image-bottom", m_imagefile_bottom)) {
-    m_image_bottom = Surface::from_file(m_imagefile_bottom);
+    m_image_bottom = load_image(m_imagefile_bottom);
     } else {
     if (!Editor::is_active()) {
       m_imagefile_bottom = m_imagefile;
@@ -189,9 +212,9 @@ Background::get_settings()
 void
 Background::after_editor_set()
 {
-  m_image_top = Surface::from_file(m_imagefile_top);
-  m_image = Surface::from_file(m_imagefile);
-  m_image_bottom = Surface::from_file(m_imagefile_bottom);
+  m_image_top = load_image(m_imagefile_top);
+  m_image = load_image(m_imagefile);
+  m_image_bottom = load_image(m_imagefile_bottom);
 }
 
 void
@@ -204,7 +227,7 @@ void
 Background::set_image(const std::string& name)
 {
   m_imagefile = name;
-  m_image = Surface::from_file(name);
+  m_image = load_image(name);
 }
 
 void
@@ -212,13 +235,13 @@ Background::set_images(const std::string& name_top,
                        const std::string& name_middle,
                        const std::string& name_bottom)
 {
-  m_image_top = Surface::from_file(name_top);
+  m_image_top = load_image(name_top);
   m_imagefile_top = name_top;
 
-  m_image = Surface::from_file(name_middle);
+  m_image = load_image(name_middle);
   m_imagefile = name_middle;
 
-  m_image_bottom = Surface::from_file(name_bottom);
+  m_image_bottom = load_image(name_bottom);
   m_imagefile_bottom = name_bottom;
 }
 
@@ -242,13 +265,9 @@ Background::draw_image(DrawingContext& context, const Vector& pos_)
   const float img_w = static_cast<float>(m_image->get_width());
   const float img_h = static_cast<float>(m_image->get_height());
 
-  const float img_w_2 = img_w / 2.0f;
-  const float img_h_2 = img_h / 2.0f;
-
-  const int start_x = static_cast<int>(floorf((cliprect.get_left() - (pos_.x - img_w /2.0f)) / img_w));
-  const int end_x   = static_cast<int>(ceilf((cliprect.get_right() - (pos_.x + img_w /2.0f)) / img_w)) + 1;
-  const int start_y = static_cast<int>(floorf((cliprect.get_top() - (pos_.y - img_h/2.0f)) / img_h));
-  const int end_y   = static_cast<int>(ceilf((cliprect.get_bottom() - (pos_.y + img_h/2.0f)) / img_h)) + 1;
+  // top left corner of the copy that is centered at pos_, all other
+  // copies line up with it
+  const Vector origin(pos_.x - img_w / 2.0f, pos_.y - img_h / 2.0f);
 
   Canvas& canvas = context.get_canvas(m_target);
 
@@ -265,62 +284,76 @@ Background::draw_image(DrawingContext& context, const Vector& pos_)
     switch (m_alignment)
     {
       case LEFT_ALIGNMENT:
-        for (int y = start_y; y < end_y; ++y)
-        {
-          Vector p(pos_.x - parallax_image_size.width / 2.0f,
-                   pos_.y + static_cast<float>(y) * img_h - img_h_2);
-          canvas.draw_surface(m_image, p, m_layer);
-        }
+      {
+        const float left = pos_.x - parallax_image_size.width / 2.0f;
+        canvas.draw_surface_repeat(m_image,
+                                   Rectf(Vector(left, cliprect.get_top()),
+                                         Vector(left + img_w, cliprect.get_bottom())),
+                                   Vector(left, origin.y), m_layer);
         break;
+      }
 
       case RIGHT_ALIGNMENT:
-        for (int y = start_y; y < end_y; ++y)
-        {
-          Vector p(pos_.x + parallax_image_size.width / 2.0f - img_w,
-                   pos_.y + static_cast<float>(y) * img_h - img_h_2);
-          canvas.draw_surface(m_image, p, m_layer);
-        }
+      {
+        const float left = pos_.x + parallax_image_size.width / 2.0f - img_w;
+        canvas.draw_surface_repeat(m_image,
+                                   Rectf(Vector(left, cliprect.get_top()),
+                                         Vector(left + img_w, cliprect.get_bottom())),
+                                   Vector(left, origin.y), m_layer);
         break;
+      }
 
       case TOP_ALIGNMENT:
-        for (int x = start_x; x < end_x; ++x)
-        {
-          Vector p(pos_.x + static_cast<float>(x) * img_w - img_w_2,
-                   pos_.y - parallax_image_size.height / 2.0f);
-          canvas.draw_surface(m_image, p, m_layer);
-        }
+      {
+        const float top = pos_.y - parallax_image_size.height / 2.0f;
+        canvas.draw_surface_repeat(m_image,
+                                   Rectf(Vector(cliprect.get_left(), top),
+                                         Vector(cliprect.get_right(), top + img_h)),
+                                   Vector(origin.x, top), m_layer);
         break;
+      }
 
       case BOTTOM_ALIGNMENT:
-        for (int x = start_x; x < end_x; ++x)
-        {
-          Vector p(pos_.x + static_cast<float>(x) * img_w - img_w_2,
-                   pos_.y - img_h + parallax_image_size.height / 2.0f);
-          canvas.draw_surface(m_image, p, m_layer);
-        }
+      {
+        const float top = pos_.y - img_h + parallax_image_size.height / 2.0f;
+        canvas.draw_surface_repeat(m_image,
+                                   Rectf(Vector(cliprect.get_left(), top),
+                                         Vector(cliprect.get_right(), top + img_h)),
+                                   Vector(origin.x, top), m_layer);
         break;
+      }
 
       case NO_ALIGNMENT:
-        for (int y = start_y; y < end_y; ++y)
-          for (int x = start_x; x < end_x; ++x)
-          {
-            Vector p(pos_.x + static_cast<float>(x) * img_w - img_w_2,
-                     pos_.y + static_cast<float>(y) * img_h - img_h_2);
-
-            if (m_image_top.get() != nullptr && (y < 0))
-            {
-              canvas.draw_surface(m_image_top, p, m_layer);
-            }
-            else if (m_image_bottom.get() != nullptr && (y > 0))
-            {
-              canvas.draw_surface(m_image_bottom, p, m_layer);
-            }
-            else
-            {
-              canvas.draw_surface(m_image, p, m_layer);
-            }
-          }
+      {
+        // the top and bottom images replace the rows above and below
+        // the one at pos_
+        const float middle_top = m_image_top ?
+          std::min(std::max(origin.y, cliprect.get_top()), cliprect.get_bottom()) :
+          cliprect.get_top();
+        const float middle_bottom = m_image_bottom ?
+          std::min(std::max(origin.y + img_h, middle_top), cliprect.get_bottom()) :
+          cliprect.get_bottom();
+
+        if (m_image_top)
+        {
+          canvas.draw_surface_repeat(m_image_top,
+                                     Rectf(cliprect.p1(), Vector(cliprect.get_right(), middle_top)),
+                                     origin, m_layer);
+        }
+
+        canvas.draw_surface_repeat(m_image,
+                                   Rectf(Vector(cliprect.get_left(), middle_top),
+                                         Vector(cliprect.get_right(), middle_bottom)),
+                                   origin, m_layer);
+
+        if (m_image_bottom)
+        {
+          canvas.draw_surface_repeat(m_image_bottom,
+                                     Rectf(Vector(cliprect.get_left(), middle_bottom), cliprect.p2()),
+                                     origin, m_layer);
+        }
         break;
+      }
     }
   }
 }
@@ -54,6 +54,7 @@ Bullet::Bullet(const Vector& pos, float xm, Direction dir, BonusType type_) :
 
   m_col.m_bbox.set_pos(pos);
   m_col.m_bbox.set_size(sprite->get_current_hitbox_width(), sprite->get_current_hitbox_height());
+  m_col.set_fast(true);
 }
 
 void
@@ -31,6 +31,7 @@ public:
 
   void init();
   virtual void update(float dt_sec) override;
+  virtual bool is_update_parallel_safe() const override { return true; }
 
   virtual std::string get_class() const override { return "particles-clouds"; }
   virtual std::string get_display_name() const override { return _("Cloud particles"); }
@@ -22,7 +22,8 @@
 Light::Light(const Vector& center, const Color& color_) :
   position(center),
   color(color_),
-  sprite(SpriteManager::current()->create("images/objects/lightmap_light/lightmap_light.sprite"))
+  sprite(SpriteManager::current()->create("images/objects/lightmap_light/lightmap_light.sprite")),
+  m_area()
 {
 }
 
@@ -40,7 +41,13 @@ Light::draw(DrawingContext& context)
 {
   sprite->set_color(color);
   sprite->set_blend(Blend::ADD);
-  sprite->draw(context.light(), position, 0);
+  if (m_area.width > 0.0f || m_area.height > 0.0f) {
+    const Vector extent(m_area.width / 2.0f + static_cast<float>(sprite->get_width()) / 2.0f,
+                        m_area.height / 2.0f + static_cast<float>(sprite->get_height()) / 2.0f);
+    sprite->draw_scaled(context.light(), Rectf(position - extent, position + extent), 0);
+  } else {
+    sprite->draw(context.light(), position, 0);
+  }
 }
 
 /* EOF */
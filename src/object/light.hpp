@@ -17,6 +17,7 @@
 #ifndef HEADER_SUPERTUX_OBJECT_LIGHT_HPP
 #define HEADER_SUPERTUX_OBJECT_LIGHT_HPP
 
+#include "math/sizef.hpp"
 #include "math/vector.hpp"
 #include "sprite/sprite_ptr.hpp"
 #include "supertux/game_object.hpp"
@@ -32,12 +33,21 @@ public:
   }
 
   virtual void update(float dt_sec) override;
+  virtual bool is_update_parallel_safe() const override { return true; }
   virtual void draw(DrawingContext& context) override;
 
+  /** Stretches the light so that it lights an area of the given size
+      around its center as evenly as the center of a point light, used
+      to replace a group of lights with one */
+  void set_area(const Sizef& area) { m_area = area; }
+
 protected:
   Vector position;
   Color color;
   SpritePtr sprite;
+
+private:
+  Sizef m_area;
 };
 
 #endif
@@ -38,6 +38,7 @@ public:
 
   virtual HitResponse collision(GameObject& other, const CollisionHit& hit) override;
   virtual void update(float dt_sec) override;
+  virtual bool is_update_parallel_safe() const override { return true; }
 
   virtual void move_to(const Vector& pos) override;
 
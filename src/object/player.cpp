@@ -945,18 +945,18 @@ Player::try_grab()
       pos = Vector(m_col.m_bbox.get_right() + 5, m_col.m_bbox.get_bottom() - 16);
     }
 
-    for (auto& moving_object : Sector::get().get_objects_by_type<MovingObject>()) {
-      Portable* portable = dynamic_cast<Portable*>(&moving_object);
-      if (portable && portable->is_portable())
+    for (auto& portable : Sector::get().get_objects_by_type<Portable>()) {
+      auto moving_object = dynamic_cast<MovingObject*>(&portable);
+      if (moving_object && portable.is_portable())
       {
         // make sure the Portable isn't currently non-solid
-        if (moving_object.get_group() == COLGROUP_DISABLED) continue;
+        if (moving_object->get_group() == COLGROUP_DISABLED) continue;
 
         // check if we are within reach
-        if (moving_object.get_bbox().contains(pos)) {
+        if (moving_object->get_bbox().contains(pos)) {
           if (m_climbing)
             stop_climbing(*m_climbing);
-          m_grabbed_object = portable;
+          m_grabbed_object = &portable;
           position_grabbed_object();
           break;
         }
@@ -1402,21 +1402,21 @@ Player::collision_solid(const CollisionHit& hit)
 HitResponse
 Player::collision(GameObject& other, const CollisionHit& hit)
 {
-  auto bullet = dynamic_cast<Bullet*> (&other);
-  if (bullet) {
+  assert(dynamic_cast<MovingObject*> (&other) != nullptr);
+  auto moving_object = static_cast<MovingObject*> (&other);
+  const CollisionObjectKind kind = moving_object->get_collision_object()->get_kind();
+
+  if (kind == COLKIND_BULLET) {
     return FORCE_MOVE;
   }
 
-  auto player = dynamic_cast<Player*> (&other);
-  if (player) {
+  if (kind == COLKIND_PLAYER) {
     return ABORT_MOVE;
   }
 
   if (hit.left || hit.right) {
     try_grab(); //grab objects right now, in update it will be too late
   }
-  assert(dynamic_cast<MovingObject*> (&other) != nullptr);
-  auto moving_object = static_cast<MovingObject*> (&other);
   if (moving_object->get_group() == COLGROUP_TOUCHABLE) {
     auto trigger = dynamic_cast<TriggerBase*> (&other);
     if (trigger && !m_deactivated) {
@@ -1427,8 +1427,7 @@ Player::collision(GameObject& other, const CollisionHit& hit)
     return FORCE_MOVE;
   }
 
-  auto badguy = dynamic_cast<BadGuy*> (&other);
-  if (badguy != nullptr) {
+  if (kind == COLKIND_BADGUY) {
     if (m_safe_timer.started() || m_invincible_timer.started())
       return FORCE_MOVE;
     if (m_stone)
@@ -143,34 +143,44 @@ TileMap::TileMap(const TileSet *tileset_, const ReaderMapping& reader) :
   m_effective_solid = m_real_solid;
   update_effective_solid ();
 
+  bool empty = true;
+
   reader.get("width", m_width);
   reader.get("height", m_height);
   if (m_width < 0 || m_height < 0) {
     //throw std::runtime_error("Invalid/No width/height specified in tilemap.");
     m_width = 0;
     m_height = 0;
-    m_tiles.clear();
+    m_tiles.reset(0, 0);
     resize(static_cast<int>(Sector::get().get_width() / 32.0f),
            static_cast<int>(Sector::get().get_height() / 32.0f));
     m_editor_active = false;
   } else {
-    if (!reader.get("tiles", m_tiles))
+    m_tiles.reset(m_width, m_height);
+
+    // tiles are read straight into the chunks, a temporary full-size
+    // std::vector would be as large as the old dense representation
+    int count = 0;
+    const int total = m_width * m_height;
+    if (!reader.get_each("tiles", [this, &count, total, &empty](uint32_t tile) {
+          if (count < total) {
+            m_tiles.set(count % m_width, count / m_width, tile);
+          }
+          count += 1;
+
+          // make sure all tiles used on the tilemap are loaded and tilemap isn't empty
+          if (tile != 0) {
+            empty = false;
+            m_tileset->get(tile);
+          }
+        }))
+    {
       throw std::runtime_error("No tiles in tilemap.");
-
-    if (int(m_tiles.size()) != m_width * m_height) {
-      throw std::runtime_error("wrong number of tiles in tilemap.");
     }
-  }
 
-  bool empty = true;
-
-  // make sure all tiles used on the tilemap are loaded and tilemap isn't empty
-  for (const auto& tile : m_tiles) {
-    if (tile != 0) {
-      empty = false;
+    if (count != total) {
+      throw std::runtime_error("wrong number of tiles in tilemap.");
     }
-
-    m_tileset->get(tile);
   }
 
   if (empty)
@@ -358,32 +368,47 @@ TileMap::draw(DrawingContext& context)
   Rect t_draw_rect = get_tiles_overlapping(draw_rect);
   Vector start = get_tile_position(t_draw_rect.left, t_draw_rect.top);
 
-  Vector pos;
-  int tx, ty;
-
   std::unordered_map<SurfacePtr,
                      std::tuple<std::vector<Rectf>,
                                 std::vector<Rectf>>> batches;
 
-  for (pos.x = start.x, tx = t_draw_rect.left; tx < t_draw_rect.right; pos.x += 32, ++tx) {
-    for (pos.y = start.y, ty = t_draw_rect.top; ty < t_draw_rect.bottom; pos.y += 32, ++ty) {
-      int index = ty*m_width + tx;
-      assert (index >= 0);
-      assert (index < (m_width * m_height));
-
-      if (m_tiles[index] == 0) continue;
-      const Tile& tile = m_tileset->get(m_tiles[index]);
-
-      if (g_debug.show_collision_rects) {
-        tile.draw_debug(context.color(), pos, LAYER_FOREGROUND1);
-      }
-
-      const SurfacePtr& surface = Editor::is_active() ? tile.get_current_editor_surface() : tile.get_current_surface();
-      if (surface) {
-        std::get<0>(batches[surface]).emplace_back(surface->get_region());
-        std::get<1>(batches[surface]).emplace_back(pos,
-                                                   Sizef(static_cast<float>(surface->get_width()),
-                                                         static_cast<float>(surface->get_height())));
+  const int chunk_size = TileStorage::CHUNK_SIZE;
+  const int chunk_left = t_draw_rect.left / chunk_size;
+  const int chunk_top = t_draw_rect.top / chunk_size;
+  const int chunk_right = (t_draw_rect.right + chunk_size - 1) / chunk_size;
+  const int chunk_bottom = (t_draw_rect.bottom + chunk_size - 1) / chunk_size;
+
+  for (int cy = chunk_top; cy < chunk_bottom; ++cy) {
+    for (int cx = chunk_left; cx < chunk_right; ++cx) {
+      // sparse layers are mostly made of empty chunks, skip them as a whole
+      if (m_tiles.is_chunk_empty(cx, cy)) continue;
+
+      const int left = std::max(t_draw_rect.left, cx * chunk_size);
+      const int right = std::min(t_draw_rect.right, (cx + 1) * chunk_size);
+      const int top = std::max(t_draw_rect.top, cy * chunk_size);
+      const int bottom = std::min(t_draw_rect.bottom, (cy + 1) * chunk_size);
+
+      for (int ty = top; ty < bottom; ++ty) {
+        for (int tx = left; tx < right; ++tx) {
+          const uint32_t id = m_tiles.get(tx, ty);
+          if (id == 0) continue;
+          const Tile& tile = m_tileset->get(id);
+
+          const Vector pos = start + Vector(static_cast<float>(tx - t_draw_rect.left),
+                                            static_cast<float>(ty - t_draw_rect.top)) * 32.0f;
+
+          if (g_debug.show_collision_rects) {
+            tile.draw_debug(context.color(), pos, LAYER_FOREGROUND1);
+          }
+
+          const SurfacePtr& surface = Editor::is_active() ? tile.get_current_editor_surface() : tile.get_current_surface();
+          if (surface) {
+            std::get<0>(batches[surface]).emplace_back(surface->get_region());
+            std::get<1>(batches[surface]).emplace_back(pos,
+                                                       Sizef(static_cast<float>(surface->get_width()),
+                                                             static_cast<float>(surface->get_height())));
+          }
+        }
       }
     }
   }
@@ -435,8 +460,7 @@ TileMap::set(int newwidth, int newheight, const std::vector<unsigned int>&newt,
   m_width  = newwidth;
   m_height = newheight;
 
-  m_tiles.resize(newt.size());
-  m_tiles = newt;
+  m_tiles.assign(newwidth, newheight, newt);
 
   if (new_z_pos > (LAYER_GUI - 100))
     m_z_pos = LAYER_GUI - 100;
@@ -446,7 +470,7 @@ TileMap::set(int newwidth, int newheight, const std::vector<unsigned int>&newt,
   update_effective_solid ();
 
   // make sure all tiles are loaded
-  for (const auto& tile : m_tiles)
+  for (const auto& tile : newt)
     m_tileset->get(tile);
 }
 
@@ -454,27 +478,30 @@ void
 TileMap::resize(int new_width, int new_height, int fill_id,
                 int xoffset, int yoffset)
 {
+  // resizing only happens in the editor, so remapping a flat copy is fine
+  std::vector<uint32_t> tiles = m_tiles.to_vector();
+
   if (new_width < m_width) {
     // remap tiles for new width
     for (int y = 0; y < m_height && y < new_height; ++y) {
       for (int x = 0; x < new_width; ++x) {
-        m_tiles[y * new_width + x] = m_tiles[y * m_width + x];
+        tiles[y * new_width + x] = tiles[y * m_width + x];
       }
     }
   }
 
-  m_tiles.resize(new_width * new_height, fill_id);
+  tiles.resize(new_width * new_height, fill_id);
 
   if (new_width > m_width) {
     // remap tiles
     for (int y = std::min(m_height, new_height)-1; y >= 0; --y) {
       for (int x = new_width-1; x >= 0; --x) {
         if (x >= m_width) {
-          m_tiles[y * new_width + x] = fill_id;
+          tiles[y * new_width + x] = fill_id;
           continue;
         }
 
-        m_tiles[y * new_width + x] = m_tiles[y * m_width + x];
+        tiles[y * new_width + x] = tiles[y * m_width + x];
       }
     }
   }
@@ -490,13 +517,15 @@ TileMap::resize(int new_width, int new_height, int fill_id,
         int X = (xoffset < 0) ? x : (m_width - x - 1);
         if (Y - yoffset < 0 || Y - yoffset >= m_height ||
             X - xoffset < 0 || X - xoffset >= m_width) {
-          m_tiles[Y * new_width + X] = fill_id;
+          tiles[Y * new_width + X] = fill_id;
         } else {
-          m_tiles[Y * new_width + X] = m_tiles[(Y - yoffset) * m_width + X - xoffset];
+          tiles[Y * new_width + X] = tiles[(Y - yoffset) * m_width + X - xoffset];
         }
       }
     }
   }
+
+  m_tiles.assign(m_width, m_height, tiles);
 }
 
 void TileMap::resize(const Size& newsize, const Size& resize_offset) {
@@ -531,7 +560,7 @@ TileMap::get_tile_id(int x, int y) const
     return 0;
   }
 
-  return m_tiles[y*m_width + x];
+  return m_tiles.get(x, y);
 }
 
 const Tile&
@@ -559,7 +588,7 @@ void
 TileMap::change(int x, int y, uint32_t newtile)
 {
   assert(x >= 0 && x < m_width && y >= 0 && y < m_height);
-  m_tiles[y*m_width + x] = newtile;
+  m_tiles.set(x, y, newtile);
 }
 
 void
@@ -27,6 +27,7 @@
 #include "squirrel/exposed_object.hpp"
 #include "scripting/tilemap.hpp"
 #include "supertux/game_object.hpp"
+#include "supertux/tile_storage.hpp"
 #include "video/color.hpp"
 #include "video/flip.hpp"
 #include "video/drawing_target.hpp"
@@ -161,8 +162,14 @@ public:
   float get_alpha() const;
 
   void set_tileset(const TileSet* new_tileset);
+  const TileSet* get_tileset() const { return m_tileset; }
 
-  const std::vector<uint32_t>& get_tiles() const { return m_tiles; }
+  /** Gives direct access to the tile ids, for scans that can skip
+      empty chunks */
+  const TileStorage& get_tile_storage() const { return m_tiles; }
+
+  /** Returns a row-major copy of all tile ids, used for saving */
+  std::vector<uint32_t> get_tiles() const { return m_tiles.to_vector(); }
 
 private:
   void update_effective_solid();
@@ -174,8 +181,7 @@ public:
 private:
   const TileSet* m_tileset;
 
-  typedef std::vector<uint32_t> Tiles;
-  Tiles m_tiles;
+  TileStorage m_tiles;
 
   /* read solid: In *general*, is this a solid layer? effective solid:
      is the layer *currently* solid? A generally solid layer may be
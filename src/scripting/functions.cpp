@@ -16,6 +16,8 @@
 
 #include "scripting/functions.hpp"
 
+#include <sstream>
+
 #include "audio/sound_manager.hpp"
 #include "math/random.hpp"
 #include "object/camera.hpp"
@@ -33,6 +35,7 @@
 #include "supertux/textscroller_screen.hpp"
 #include "supertux/tile.hpp"
 #include "video/renderer.hpp"
+#include "video/texture_manager.hpp"
 #include "video/video_system.hpp"
 #include "video/viewport.hpp"
 #include "worldmap/tux.hpp"
@@ -202,6 +205,21 @@ void debug_worldmap_ghost(bool enable)
   tux.set_ghost_mode(enable);
 }
 
+void debug_texture_memory()
+{
+  std::ostringstream out;
+  TextureManager::current()->print_memory_usage(out);
+  log_info << out.str() << std::flush;
+}
+
+void debug_set_texture_budget(int megabytes)
+{
+  if (megabytes < 0)
+    throw std::runtime_error("Texture budget can't be negative");
+
+  TextureManager::current()->set_texture_budget(static_cast<size_t>(megabytes) * 1024 * 1024);
+}
+
 void save_state()
 {
   auto worldmap = worldmap::WorldMap::current();
@@ -92,6 +92,12 @@ void debug_draw_editor_images(bool enable);
 /** enable/disable worldmap ghost mode */
 void debug_worldmap_ghost(bool enable);
 
+/** print the memory used by textures and decoded images */
+void debug_texture_memory();
+
+/** limit the memory used by textures to 'megabytes', 0 removes the limit */
+void debug_set_texture_budget(int megabytes);
+
 /** Changes music to musicfile */
 void play_music(const std::string& musicfile);
 
@@ -21,6 +21,14 @@
 
 namespace scripting {
 
+#ifdef BUILD_TESTS
+namespace {
+
+GameObjectManager* s_fallback_game_object_manager = nullptr;
+
+} // namespace
+#endif
+
 GameObjectManager& get_game_object_manager()
 {
   using namespace worldmap;
@@ -29,11 +37,22 @@ GameObjectManager& get_game_object_manager()
     return ::Sector::get();
   } else if (WorldMap::current() != nullptr) {
     return *WorldMap::current();
+#ifdef BUILD_TESTS
+  } else if (s_fallback_game_object_manager != nullptr) {
+    return *s_fallback_game_object_manager;
+#endif
   } else {
     throw std::runtime_error("Neither sector nor worldmap active");
   }
 }
 
+#ifdef BUILD_TESTS
+void set_fallback_game_object_manager(GameObjectManager* manager)
+{
+  s_fallback_game_object_manager = manager;
+}
+#endif
+
 } // namespace scripting
 
 /* EOF */
@@ -17,6 +17,8 @@
 #ifndef HEADER_SUPERTUX_SCRIPTING_GAME_OBJECT_HPP
 #define HEADER_SUPERTUX_SCRIPTING_GAME_OBJECT_HPP
 
+#include <config.h>
+
 #include "supertux/game_object_manager.hpp"
 #include "util/log.hpp"
 #include "util/uid.hpp"
@@ -56,6 +58,13 @@ namespace scripting {
 
 GameObjectManager& get_game_object_manager();
 
+#ifdef BUILD_TESTS
+/** Sets the manager get_game_object_manager() falls back to when
+    neither a sector nor a worldmap is active, so that tests can call
+    scripting objects without loading a level */
+void set_fallback_game_object_manager(GameObjectManager* manager);
+#endif
+
 template<class T>
 class GameObject
 {
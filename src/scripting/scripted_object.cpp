@@ -62,6 +62,14 @@ ScriptedObject::get_pos_y() const
   return object.get_pos_y();
 }
 
+void
+ScriptedObject::get_pos(float& x, float& y) const
+{
+  SCRIPT_GUARD_VOID;
+  x = object.get_pos_x();
+  y = object.get_pos_y();
+}
+
 void
 ScriptedObject::set_velocity(float x, float y)
 {
@@ -83,6 +91,14 @@ ScriptedObject::get_velocity_y() const
   return object.get_velocity_y();
 }
 
+void
+ScriptedObject::get_velocity(float& x, float& y) const
+{
+  SCRIPT_GUARD_VOID;
+  x = object.get_velocity_x();
+  y = object.get_velocity_y();
+}
+
 void
 ScriptedObject::enable_gravity(bool f)
 {
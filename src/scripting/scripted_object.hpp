@@ -48,10 +48,14 @@ public:
   void set_pos(float x, float y);
   float get_pos_x() const;
   float get_pos_y() const;
+  /** Returns the position as [x, y] with a single call */
+  void get_pos(float& x, float& y) const;
 
   void set_velocity(float x, float y);
   float get_velocity_x() const;
   float get_velocity_y() const;
+  /** Returns the velocity as [x, y] with a single call */
+  void get_velocity(float& x, float& y) const;
 
   void enable_gravity(bool f);
   bool gravity_enabled() const;
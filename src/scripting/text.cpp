@@ -83,6 +83,14 @@ Text::get_pos_y() const
   return object.get_pos().y;
 }
 
+void
+Text::get_pos(float& x, float& y) const
+{
+  SCRIPT_GUARD_VOID;
+  x = object.get_pos().x;
+  y = object.get_pos().y;
+}
+
 void
 Text::set_anchor_point(int anchor)
 {
@@ -50,6 +50,8 @@ public:
   void set_pos(float x, float y);
   float get_pos_x() const;
   float get_pos_y() const;
+  /** Returns the position as [x, y] with a single call */
+  void get_pos(float& x, float& y) const;
   void set_anchor_point(int anchor);
   int  get_anchor_point() const;
 };
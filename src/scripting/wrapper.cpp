@@ -2784,6 +2784,42 @@ static SQInteger ScriptedObject_get_pos_y_wrapper(HSQUIRRELVM vm)
 
 }
 
+static SQInteger ScriptedObject_get_pos_wrapper(HSQUIRRELVM vm)
+{
+  SQUserPointer data;
+  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr)) || !data) {
+    sq_throwerror(vm, _SC("'get_pos' called without instance"));
+    return SQ_ERROR;
+  }
+  auto _this = reinterpret_cast<scripting::ScriptedObject*> (data);
+
+  if (_this == nullptr) {
+    return SQ_ERROR;
+  }
+
+  float arg0 = {};
+  float arg1 = {};
+
+  try {
+    _this->get_pos(arg0, arg1);
+
+    sq_newarray(vm, 0);
+    sq_pushfloat(vm, arg0);
+    sq_arrayappend(vm, -2);
+    sq_pushfloat(vm, arg1);
+    sq_arrayappend(vm, -2);
+    return 1;
+
+  } catch(std::exception& e) {
+    sq_throwerror(vm, e.what());
+    return SQ_ERROR;
+  } catch(...) {
+    sq_throwerror(vm, _SC("Unexpected exception while executing function 'get_pos'"));
+    return SQ_ERROR;
+  }
+
+}
+
 static SQInteger ScriptedObject_set_velocity_wrapper(HSQUIRRELVM vm)
 {
   SQUserPointer data;
@@ -2883,6 +2919,42 @@ static SQInteger ScriptedObject_get_velocity_y_wrapper(HSQUIRRELVM vm)
 
 }
 
+static SQInteger ScriptedObject_get_velocity_wrapper(HSQUIRRELVM vm)
+{
+  SQUserPointer data;
+  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr)) || !data) {
+    sq_throwerror(vm, _SC("'get_velocity' called without instance"));
+    return SQ_ERROR;
+  }
+  auto _this = reinterpret_cast<scripting::ScriptedObject*> (data);
+
+  if (_this == nullptr) {
+    return SQ_ERROR;
+  }
+
+  float arg0 = {};
+  float arg1 = {};
+
+  try {
+    _this->get_velocity(arg0, arg1);
+
+    sq_newarray(vm, 0);
+    sq_pushfloat(vm, arg0);
+    sq_arrayappend(vm, -2);
+    sq_pushfloat(vm, arg1);
+    sq_arrayappend(vm, -2);
+    return 1;
+
+  } catch(std::exception& e) {
+    sq_throwerror(vm, e.what());
+    return SQ_ERROR;
+  } catch(...) {
+    sq_throwerror(vm, _SC("Unexpected exception while executing function 'get_velocity'"));
+    return SQ_ERROR;
+  }
+
+}
+
 static SQInteger ScriptedObject_enable_gravity_wrapper(HSQUIRRELVM vm)
 {
   SQUserPointer data;
@@ -3674,6 +3746,42 @@ static SQInteger Text_get_pos_y_wrapper(HSQUIRRELVM vm)
 
 }
 
+static SQInteger Text_get_pos_wrapper(HSQUIRRELVM vm)
+{
+  SQUserPointer data;
+  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr)) || !data) {
+    sq_throwerror(vm, _SC("'get_pos' called without instance"));
+    return SQ_ERROR;
+  }
+  auto _this = reinterpret_cast<scripting::Text*> (data);
+
+  if (_this == nullptr) {
+    return SQ_ERROR;
+  }
+
+  float arg0 = {};
+  float arg1 = {};
+
+  try {
+    _this->get_pos(arg0, arg1);
+
+    sq_newarray(vm, 0);
+    sq_pushfloat(vm, arg0);
+    sq_arrayappend(vm, -2);
+    sq_pushfloat(vm, arg1);
+    sq_arrayappend(vm, -2);
+    return 1;
+
+  } catch(std::exception& e) {
+    sq_throwerror(vm, e.what());
+    return SQ_ERROR;
+  } catch(...) {
+    sq_throwerror(vm, _SC("Unexpected exception while executing function 'get_pos'"));
+    return SQ_ERROR;
+  }
+
+}
+
 static SQInteger Text_set_anchor_point_wrapper(HSQUIRRELVM vm)
 {
   SQUserPointer data;
@@ -5888,6 +5996,48 @@ static SQInteger debug_worldmap_ghost_wrapper(HSQUIRRELVM vm)
 
 }
 
+static SQInteger debug_texture_memory_wrapper(HSQUIRRELVM vm)
+{
+  (void) vm;
+
+  try {
+    scripting::debug_texture_memory();
+
+    return 0;
+
+  } catch(std::exception& e) {
+    sq_throwerror(vm, e.what());
+    return SQ_ERROR;
+  } catch(...) {
+    sq_throwerror(vm, _SC("Unexpected exception while executing function 'debug_texture_memory'"));
+    return SQ_ERROR;
+  }
+
+}
+
+static SQInteger debug_set_texture_budget_wrapper(HSQUIRRELVM vm)
+{
+  SQInteger arg0;
+  if(SQ_FAILED(sq_getinteger(vm, 2, &arg0))) {
+    sq_throwerror(vm, _SC("Argument 1 not an integer"));
+    return SQ_ERROR;
+  }
+
+  try {
+    scripting::debug_set_texture_budget(static_cast<int> (arg0));
+
+    return 0;
+
+  } catch(std::exception& e) {
+    sq_throwerror(vm, e.what());
+    return SQ_ERROR;
+  } catch(...) {
+    sq_throwerror(vm, _SC("Unexpected exception while executing function 'debug_set_texture_budget'"));
+    return SQ_ERROR;
+  }
+
+}
+
 static SQInteger play_music_wrapper(HSQUIRRELVM vm)
 {
   const SQChar* arg0;
@@ -7148,6 +7298,20 @@ void register_supertux_wrapper(HSQUIRRELVM v)
     throw SquirrelError(v, "Couldn't register function 'debug_worldmap_ghost'");
   }
 
+  sq_pushstring(v, "debug_texture_memory", -1);
+  sq_newclosure(v, &debug_texture_memory_wrapper, 0);
+  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, "x|t");
+  if(SQ_FAILED(sq_createslot(v, -3))) {
+    throw SquirrelError(v, "Couldn't register function 'debug_texture_memory'");
+  }
+
+  sq_pushstring(v, "debug_set_texture_budget", -1);
+  sq_newclosure(v, &debug_set_texture_budget_wrapper, 0);
+  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, "x|ti");
+  if(SQ_FAILED(sq_createslot(v, -3))) {
+    throw SquirrelError(v, "Couldn't register function 'debug_set_texture_budget'");
+  }
+
   sq_pushstring(v, "play_music", -1);
   sq_newclosure(v, &play_music_wrapper, 0);
   sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, "x|ts");
@@ -8019,6 +8183,13 @@ void register_supertux_wrapper(HSQUIRRELVM v)
     throw SquirrelError(v, "Couldn't register function 'get_pos_y'");
   }
 
+  sq_pushstring(v, "get_pos", -1);
+  sq_newclosure(v, &ScriptedObject_get_pos_wrapper, 0);
+  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, "x|t");
+  if(SQ_FAILED(sq_createslot(v, -3))) {
+    throw SquirrelError(v, "Couldn't register function 'get_pos'");
+  }
+
   sq_pushstring(v, "set_velocity", -1);
   sq_newclosure(v, &ScriptedObject_set_velocity_wrapper, 0);
   sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, "x|tnn");
@@ -8040,6 +8211,13 @@ void register_supertux_wrapper(HSQUIRRELVM v)
     throw SquirrelError(v, "Couldn't register function 'get_velocity_y'");
   }
 
+  sq_pushstring(v, "get_velocity", -1);
+  sq_newclosure(v, &ScriptedObject_get_velocity_wrapper, 0);
+  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, "x|t");
+  if(SQ_FAILED(sq_createslot(v, -3))) {
+    throw SquirrelError(v, "Couldn't register function 'get_velocity'");
+  }
+
   sq_pushstring(v, "enable_gravity", -1);
   sq_newclosure(v, &ScriptedObject_enable_gravity_wrapper, 0);
   sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, "x|tb");
@@ -8223,6 +8401,13 @@ void register_supertux_wrapper(HSQUIRRELVM v)
     throw SquirrelError(v, "Couldn't register function 'get_pos_y'");
   }
 
+  sq_pushstring(v, "get_pos", -1);
+  sq_newclosure(v, &Text_get_pos_wrapper, 0);
+  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, "x|t");
+  if(SQ_FAILED(sq_createslot(v, -3))) {
+    throw SquirrelError(v, "Couldn't register function 'get_pos'");
+  }
+
   sq_pushstring(v, "set_anchor_point", -1);
   sq_newclosure(v, &Text_set_anchor_point_wrapper, 0);
   sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, "x|ti");
@@ -16,18 +16,108 @@
 
 #include "sprite/sprite.hpp"
 
+#include <algorithm>
 #include <assert.h>
+#include <math.h>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <vector>
 
 #include "supertux/globals.hpp"
 #include "util/log.hpp"
 #include "video/surface.hpp"
 
+namespace {
+
+/** Hands out memory for sprites in blocks and keeps the memory of
+    destroyed sprites in a free list. Blocks are never returned. */
+class SpritePool final
+{
+public:
+  static const size_t BLOCK_SIZE = 256;
+
+public:
+  SpritePool() :
+    m_mutex(),
+    m_blocks(),
+    m_free()
+  {}
+
+  void* allocate()
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    if (m_free.empty())
+    {
+      m_blocks.emplace_back(new Slot[BLOCK_SIZE]);
+      Slot* block = m_blocks.back().get();
+      for (size_t i = BLOCK_SIZE; i > 0; --i)
+      {
+        m_free.push_back(&block[i - 1]);
+      }
+    }
+
+    void* ptr = m_free.back();
+    m_free.pop_back();
+    return ptr;
+  }
+
+  void release(void* ptr)
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_free.push_back(static_cast<Slot*>(ptr));
+  }
+
+private:
+  struct Slot
+  {
+    alignas(Sprite) unsigned char data[sizeof(Sprite)];
+  };
+
+  // nothing larger than a Sprite may be allocated from the pool
+  static_assert(std::is_final<Sprite>::value, "classes derived from Sprite don't fit into a Slot");
+
+  std::mutex m_mutex;
+  std::vector<std::unique_ptr<Slot[]> > m_blocks;
+  std::vector<Slot*> m_free;
+
+private:
+  SpritePool(const SpritePool&) = delete;
+  SpritePool& operator=(const SpritePool&) = delete;
+};
+
+SpritePool& get_pool()
+{
+  // never destroyed, sprites held by globals may be freed after
+  // static destructors ran
+  static SpritePool* pool = new SpritePool;
+  return *pool;
+}
+
+} // namespace
+
+void*
+Sprite::operator new(size_t /*size*/)
+{
+  return get_pool().allocate();
+}
+
+void
+Sprite::operator delete(void* ptr)
+{
+  if (ptr)
+  {
+    get_pool().release(ptr);
+  }
+}
+
 Sprite::Sprite(SpriteData& newdata) :
   m_data(newdata),
-  m_frame(0),
+  m_start_time(g_game_time),
+  m_start_frame(0.0f),
   m_frameidx(0),
   m_animation_loops(-1),
-  m_last_ticks(),
   m_angle(0.0f),
   m_color(1.0f, 1.0f, 1.0f, 1.0f),
   m_blend(),
@@ -35,15 +125,14 @@ Sprite::Sprite(SpriteData& newdata) :
 {
   if (!m_action)
     m_action = m_data.actions.begin()->second.get();
-  m_last_ticks = g_game_time;
 }
 
 Sprite::Sprite(const Sprite& other) :
   m_data(other.m_data),
-  m_frame(other.m_frame),
+  m_start_time(other.m_start_time),
+  m_start_frame(other.m_start_frame),
   m_frameidx(other.m_frameidx),
   m_animation_loops(other.m_animation_loops),
-  m_last_ticks(g_game_time),
   m_angle(0.0f), // FIXME: this can't be right
   m_color(1.0f, 1.0f, 1.0f, 1.0f),
   m_blend(),
@@ -77,7 +166,8 @@ Sprite::set_action(const std::string& name, int loops)
   // If the new action has a loops property,
   // we prefer that over the parameter.
   m_animation_loops = newaction->has_custom_loops ? newaction->loops : loops;
-  m_frame = 0;
+  m_start_time = g_game_time;
+  m_start_frame = 0.0f;
   m_frameidx = 0;
 }
 
@@ -93,6 +183,11 @@ Sprite::set_action_continued(const std::string& name)
     return;
   }
 
+  // continue from the current position at the speed of the new action
+  update();
+  m_start_frame = m_action->get_position(m_start_time, m_start_frame);
+  m_start_time = g_game_time;
+
   m_action = newaction;
   update();
 }
@@ -106,27 +201,37 @@ Sprite::animation_done() const
 void
 Sprite::update()
 {
-  float frame_inc = m_action->fps * (g_game_time - m_last_ticks);
-  m_last_ticks = g_game_time;
+  const int frames = get_frames();
 
-  m_frame += frame_inc;
-
-  while (m_frame >= 1.0f) {
-    m_frame -= 1.0f;
-    m_frameidx++;
+  if (animation_done())
+  {
+    m_frameidx = frames - 1;
+    return;
   }
 
-  while (m_frameidx >= get_frames()) {
-    m_frameidx -= get_frames();
-    m_animation_loops--;
-    if (animation_done()) {
-      break;
-    }
+  const float position = m_action->get_position(m_start_time, m_start_frame);
+  const int elapsed = std::max(0, static_cast<int>(floorf(position)));
+  const int cycles = elapsed / frames;
+
+  if (m_animation_loops >= 0 && cycles >= m_animation_loops)
+  {
+    m_animation_loops = 0;
+    m_frameidx = frames - 1;
+    return;
   }
 
-  if (animation_done()) {
-    m_frame = 0;
-    m_frameidx = get_frames() - 1;
+  m_frameidx = elapsed % frames;
+
+  if (cycles > 0)
+  {
+    // Completed cycles are taken out of the start position, so the
+    // loop counter only counts the cycles still to come. Sprites that
+    // started together still end up with the same start position.
+    if (m_animation_loops > 0)
+    {
+      m_animation_loops -= cycles;
+    }
+    m_start_frame -= static_cast<float>(cycles * frames);
   }
 
   assert(m_frameidx < get_frames());
@@ -155,6 +260,19 @@ Sprite::draw(Canvas& canvas, const Vector& pos, int layer,
   context.pop_transform();
 }
 
+void
+Sprite::draw_scaled(Canvas& canvas, const Rectf& dest, int layer)
+{
+  assert(m_action != nullptr);
+  update();
+
+  PaintStyle style;
+  style.set_color(m_color);
+  style.set_blend(m_blend);
+
+  canvas.draw_surface_scaled(m_action->surfaces[m_frameidx], dest, layer, style);
+}
+
 int
 Sprite::get_width() const
 {
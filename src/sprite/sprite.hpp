@@ -17,6 +17,8 @@
 #ifndef HEADER_SUPERTUX_SPRITE_SPRITE_HPP
 #define HEADER_SUPERTUX_SPRITE_SPRITE_HPP
 
+#include <stddef.h>
+
 #include "sprite/sprite_data.hpp"
 #include "sprite/sprite_ptr.hpp"
 #include "video/canvas.hpp"
@@ -28,12 +30,21 @@ public:
   Sprite(SpriteData& data);
   ~Sprite();
 
+  /** Sprites are allocated from a pool, as coins, particles and
+      similar objects create and destroy lots of them */
+  static void* operator new(size_t size);
+  static void operator delete(void* ptr);
+
   SpritePtr clone() const;
 
   /** Draw sprite, automatically calculates next frame */
   void draw(Canvas& canvas, const Vector& pos, int layer,
             Flip flip = NO_FLIP);
 
+  /** Draw the current frame stretched to fill dest, ignoring the
+      hitbox offset */
+  void draw_scaled(Canvas& canvas, const Rectf& dest, int layer);
+
   /** Set action (or state) */
   void set_action(const std::string& name, int loops = -1);
 
@@ -94,12 +105,14 @@ private:
 
   SpriteData& m_data;
 
-  // between 0 and 1
-  float m_frame;
+  /** The animation is at frame position m_start_frame at
+      m_start_time, the current frame follows from g_game_time */
+  float m_start_time;
+  float m_start_frame;
+
   // between 0 and get_frames()
   int m_frameidx;
   int m_animation_loops;
-  float m_last_ticks;
   float m_angle;
   Color m_color;
   Blend m_blend;
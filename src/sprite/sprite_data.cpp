@@ -20,6 +20,7 @@
 #include <stdexcept>
 #include <sstream>
 
+#include "supertux/globals.hpp"
 #include "util/file_system.hpp"
 #include "util/log.hpp"
 #include "util/reader_collection.hpp"
@@ -41,6 +42,12 @@ SpriteData::Action::Action() :
 {
 }
 
+float
+SpriteData::Action::get_position(float start_time, float start_frame) const
+{
+  return start_frame + fps * (g_game_time - start_time);
+}
+
 SpriteData::SpriteData(const ReaderMapping& mapping) :
   actions(),
   name()
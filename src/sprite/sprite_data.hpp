@@ -66,6 +66,11 @@ private:
     bool has_custom_loops;
 
     std::vector<SurfacePtr> surfaces;
+
+    /** Returns the number of frames that passed since start_time,
+        plus start_frame. Only depends on g_game_time, so it is safe
+        to call from the parallel update phase. */
+    float get_position(float start_time, float start_frame) const;
   };
 
   typedef std::map <std::string, std::unique_ptr<Action> > Actions;
@@ -27,15 +27,35 @@
 #include "supertux/globals.hpp"
 #include "util/log.hpp"
 
+namespace {
+
+std::vector<SquirrelEnvironment*> s_environments;
+
+} // namespace
+
+SquirrelEnvironment*
+SquirrelEnvironment::from_table(const HSQOBJECT& table)
+{
+  if (table._type != OT_TABLE)
+    return nullptr;
+
+  for (auto* environment : s_environments) {
+    if (environment->m_table._unVal.pTable == table._unVal.pTable) {
+      return environment;
+    }
+  }
+  return nullptr;
+}
+
 SquirrelEnvironment::SquirrelEnvironment(SquirrelVM& vm, const std::string& name) :
   m_vm(vm),
   m_table(),
   m_name(name),
   m_scripts(),
-  m_scheduler(std::make_unique<SquirrelScheduler>(m_vm))
+  m_scheduler(std::make_unique<SquirrelScheduler>(m_vm)),
+  m_exposed_names()
 {
-  // garbage collector has to be invoked manually
-  sq_collectgarbage(m_vm.get_vm());
+  request_garbage_collection();
 
   sq_newtable(m_vm.get_vm());
   sq_pushroottable(m_vm.get_vm());
@@ -49,10 +69,15 @@ SquirrelEnvironment::SquirrelEnvironment(SquirrelVM& vm, const std::string& name
 
   sq_addref(m_vm.get_vm(), &m_table);
   sq_pop(m_vm.get_vm(), 1);
+
+  s_environments.push_back(this);
 }
 
 SquirrelEnvironment::~SquirrelEnvironment()
 {
+  s_environments.erase(std::remove(s_environments.begin(), s_environments.end(), this),
+                       s_environments.end());
+
   for (auto& script: m_scripts)
   {
     sq_release(m_vm.get_vm(), &script);
@@ -60,7 +85,20 @@ SquirrelEnvironment::~SquirrelEnvironment()
   m_scripts.clear();
   sq_release(m_vm.get_vm(), &m_table);
 
-  sq_collectgarbage(m_vm.get_vm());
+  request_garbage_collection();
+}
+
+void
+SquirrelEnvironment::request_garbage_collection()
+{
+  // collect during the idle time of a later frame when possible, to
+  // avoid stalling on sector switches
+  auto squirrel_vm = SquirrelVirtualMachine::current();
+  if (squirrel_vm && &squirrel_vm->get_vm() == &m_vm) {
+    squirrel_vm->request_garbage_collection();
+  } else {
+    sq_collectgarbage(m_vm.get_vm());
+  }
 }
 
 void
@@ -81,22 +119,70 @@ SquirrelEnvironment::unexpose_self()
 
 void
 SquirrelEnvironment::try_expose(GameObject& object)
+{
+  if (object.get_name().empty())
+    return;
+
+  sq_pushobject(m_vm.get_vm(), m_table);
+  expose_on_table(object);
+  sq_pop(m_vm.get_vm(), 1);
+}
+
+void
+SquirrelEnvironment::try_unexpose(GameObject& object)
+{
+  if (object.get_name().empty())
+    return;
+
+  SQInteger oldtop = sq_gettop(m_vm.get_vm());
+  sq_pushobject(m_vm.get_vm(), m_table);
+  unexpose_on_table(object);
+  sq_settop(m_vm.get_vm(), oldtop);
+}
+
+void
+SquirrelEnvironment::try_expose(const std::vector<std::unique_ptr<GameObject> >& objects)
+{
+  sq_pushobject(m_vm.get_vm(), m_table);
+  for (const auto& object : objects) {
+    if (!object->get_name().empty()) {
+      expose_on_table(*object);
+    }
+  }
+  sq_pop(m_vm.get_vm(), 1);
+}
+
+void
+SquirrelEnvironment::try_unexpose(const std::vector<std::unique_ptr<GameObject> >& objects)
+{
+  SQInteger oldtop = sq_gettop(m_vm.get_vm());
+  sq_pushobject(m_vm.get_vm(), m_table);
+  for (const auto& object : objects) {
+    if (!object->get_name().empty()) {
+      unexpose_on_table(*object);
+    }
+  }
+  sq_settop(m_vm.get_vm(), oldtop);
+}
+
+void
+SquirrelEnvironment::expose_on_table(GameObject& object)
 {
   auto script_object = dynamic_cast<ScriptInterface*>(&object);
   if (script_object != nullptr) {
-    sq_pushobject(m_vm.get_vm(), m_table);
     script_object->expose(m_vm.get_vm(), -1);
-    sq_pop(m_vm.get_vm(), 1);
+    m_exposed_names.add(object.get_name() + ".");
   }
 }
 
 void
-SquirrelEnvironment::try_unexpose(GameObject& object)
+SquirrelEnvironment::unexpose_on_table(GameObject& object)
 {
   auto script_object = dynamic_cast<ScriptInterface*>(&object);
   if (script_object != nullptr) {
+    m_exposed_names.remove(object.get_name() + ".");
+
     SQInteger oldtop = sq_gettop(m_vm.get_vm());
-    sq_pushobject(m_vm.get_vm(), m_table);
     try {
       script_object->unexpose(m_vm.get_vm(), -1);
     } catch(std::exception& e) {
@@ -109,6 +195,8 @@ SquirrelEnvironment::try_unexpose(GameObject& object)
 void
 SquirrelEnvironment::unexpose(const std::string& name)
 {
+  m_exposed_names.remove(name + ".");
+
   SQInteger oldtop = sq_gettop(m_vm.get_vm());
   sq_pushobject(m_vm.get_vm(), m_table);
   try {
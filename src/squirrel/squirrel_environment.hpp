@@ -18,12 +18,14 @@
 #ifndef HEADER_SUPERTUX_SQUIRREL_SQUIRREL_ENVIRONMENT_HPP
 #define HEADER_SUPERTUX_SQUIRREL_SQUIRREL_ENVIRONMENT_HPP
 
+#include <memory>
 #include <string>
 #include <vector>
 
 #include <squirrel.h>
 
 #include "squirrel/squirrel_util.hpp"
+#include "util/prefix_trie.hpp"
 
 class GameObject;
 class ScriptInterface;
@@ -38,18 +40,33 @@ public:
   SquirrelEnvironment(SquirrelVM& vm, const std::string& name);
   virtual ~SquirrelEnvironment();
 
+public:
+  /** Returns the environment that owns 'table', or nullptr */
+  static SquirrelEnvironment* from_table(const HSQOBJECT& table);
+
 public:
   SquirrelVM& get_vm() const { return m_vm; }
 
+  /** Names of the exposed objects, each followed by a ".", kept up to
+      date so that the console can complete them without walking the
+      table */
+  const PrefixTrie& get_exposed_names() const { return m_exposed_names; }
+
   /** Expose this engine under 'name' */
   void expose_self();
   void unexpose_self();
 
   /** Expose the GameObject if it has a ScriptInterface, otherwise do
-      nothing. */
+      nothing. Scripts can only look objects up by name, so anonymous
+      objects (bullets, particles, ...) never touch the VM. */
   void try_expose(GameObject& object);
   void try_unexpose(GameObject& object);
 
+  /** Same as try_expose()/try_unexpose() for a whole list of objects,
+      the table is only pushed once for all of them */
+  void try_expose(const std::vector<std::unique_ptr<GameObject> >& objects);
+  void try_unexpose(const std::vector<std::unique_ptr<GameObject> >& objects);
+
   /** Generic expose function, T must be a type that has a
       create_squirrel_instance() associated with it. */
   template<typename T>
@@ -58,6 +75,7 @@ public:
     sq_pushobject(m_vm.get_vm(), m_table);
     expose_object(m_vm.get_vm(), -1, std::move(script_object), name.c_str());
     sq_pop(m_vm.get_vm(), 1);
+    m_exposed_names.add(name + ".");
   }
   void unexpose(const std::string& name);
 
@@ -76,6 +94,11 @@ public:
 
 private:
   void garbage_collect();
+  void request_garbage_collection();
+
+  /** Exposes or unexposes the object on the table at the top of the stack */
+  void expose_on_table(GameObject& object);
+  void unexpose_on_table(GameObject& object);
 
 private:
   SquirrelVM& m_vm;
@@ -83,6 +106,7 @@ private:
   std::string m_name;
   std::vector<HSQOBJECT> m_scripts;
   std::unique_ptr<SquirrelScheduler> m_scheduler;
+  PrefixTrie m_exposed_names;
 
 private:
   SquirrelEnvironment(const SquirrelEnvironment&) = delete;
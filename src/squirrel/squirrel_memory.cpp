@@ -0,0 +1,238 @@
+//  SuperTux
+//  Copyright (C) 2020 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "squirrel/squirrel_memory.hpp"
+
+#include <config.h>
+
+#include <algorithm>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+#include <squirrel.h>
+
+namespace {
+
+/** Block sizes are rounded up to this */
+const size_t GRANULARITY = 16;
+
+/** Blocks larger than this are not pooled */
+const size_t MAX_POOLED_SIZE = 256;
+
+const size_t NUM_SIZE_CLASSES = MAX_POOLED_SIZE / GRANULARITY;
+
+/** Size of the chunks the pools carve their blocks from */
+const size_t PAGE_SIZE = 64 * 1024;
+
+struct FreeBlock
+{
+  FreeBlock* next;
+};
+
+class SmallBlockPool final
+{
+public:
+  SmallBlockPool() :
+    m_free_lists(),
+    m_pages(),
+    m_page_pos(nullptr),
+    m_page_end(nullptr),
+    m_heap_size(0),
+    m_allocation_count(0)
+  {
+    std::fill(std::begin(m_free_lists), std::end(m_free_lists), nullptr);
+  }
+
+  ~SmallBlockPool()
+  {
+    for (void* page : m_pages) {
+      free(page);
+    }
+  }
+
+  void* allocate(size_t size)
+  {
+    m_heap_size += size;
+    m_allocation_count += 1;
+
+    if (size > MAX_POOLED_SIZE) {
+      return malloc(size);
+    }
+
+    const size_t size_class = get_size_class(size);
+    if (FreeBlock* block = m_free_lists[size_class]) {
+      m_free_lists[size_class] = block->next;
+      return block;
+    }
+
+    const size_t block_size = (size_class + 1) * GRANULARITY;
+    if (m_page_pos == nullptr || static_cast<size_t>(m_page_end - m_page_pos) < block_size) {
+      char* page = static_cast<char*>(malloc(PAGE_SIZE));
+      if (!page)
+        return nullptr;
+
+      m_pages.push_back(page);
+      m_page_pos = page;
+      m_page_end = page + PAGE_SIZE;
+    }
+
+    void* ptr = m_page_pos;
+    m_page_pos += block_size;
+    return ptr;
+  }
+
+  void deallocate(void* ptr, size_t size)
+  {
+    if (!ptr)
+      return;
+
+    m_heap_size -= size;
+
+    if (size > MAX_POOLED_SIZE) {
+      free(ptr);
+      return;
+    }
+
+    const size_t size_class = get_size_class(size);
+    FreeBlock* block = static_cast<FreeBlock*>(ptr);
+    block->next = m_free_lists[size_class];
+    m_free_lists[size_class] = block;
+  }
+
+  void* reallocate(void* ptr, size_t old_size, size_t size)
+  {
+    if (!ptr)
+      return allocate(size);
+
+    if (old_size > MAX_POOLED_SIZE && size > MAX_POOLED_SIZE) {
+      void* new_ptr = realloc(ptr, size);
+      if (!new_ptr)
+        return nullptr;
+
+      m_heap_size += size;
+      m_heap_size -= old_size;
+      return new_ptr;
+    }
+
+    if (old_size <= MAX_POOLED_SIZE && size <= MAX_POOLED_SIZE &&
+        get_size_class(old_size) == get_size_class(size)) {
+      m_heap_size += size;
+      m_heap_size -= old_size;
+      return ptr;
+    }
+
+    void* new_ptr = allocate(size);
+    if (!new_ptr)
+      return nullptr;
+
+    memcpy(new_ptr, ptr, std::min(old_size, size));
+    deallocate(ptr, old_size);
+    return new_ptr;
+  }
+
+  SquirrelMemory::Stats get_stats() const
+  {
+    return { m_heap_size, m_allocation_count, m_pages.size() * PAGE_SIZE };
+  }
+
+private:
+  static size_t get_size_class(size_t size)
+  {
+    return size == 0 ? 0 : (size - 1) / GRANULARITY;
+  }
+
+private:
+  FreeBlock* m_free_lists[NUM_SIZE_CLASSES];
+  std::vector<char*> m_pages;
+  char* m_page_pos;
+  char* m_page_end;
+
+  size_t m_heap_size;
+  size_t m_allocation_count;
+
+private:
+  SmallBlockPool(const SmallBlockPool&) = delete;
+  SmallBlockPool& operator=(const SmallBlockPool&) = delete;
+};
+
+SmallBlockPool& get_pool()
+{
+  static SmallBlockPool pool;
+  return pool;
+}
+
+} // namespace
+
+void*
+SquirrelMemory::allocate(size_t size)
+{
+  return get_pool().allocate(size);
+}
+
+void*
+SquirrelMemory::reallocate(void* ptr, size_t old_size, size_t size)
+{
+  return get_pool().reallocate(ptr, old_size, size);
+}
+
+void
+SquirrelMemory::deallocate(void* ptr, size_t size)
+{
+  get_pool().deallocate(ptr, size);
+}
+
+SquirrelMemory::Stats
+SquirrelMemory::get_stats()
+{
+  return get_pool().get_stats();
+}
+
+bool
+SquirrelMemory::is_enabled()
+{
+#ifdef ENABLE_SQUIRREL_POOL
+  return true;
+#else
+  return false;
+#endif
+}
+
+#ifdef ENABLE_SQUIRREL_POOL
+
+// replacements for the functions from squirrel/sqmem.cpp
+void* sq_vm_malloc(SQUnsignedInteger size);
+void* sq_vm_realloc(void* p, SQUnsignedInteger oldsize, SQUnsignedInteger size);
+void sq_vm_free(void* p, SQUnsignedInteger size);
+
+void* sq_vm_malloc(SQUnsignedInteger size)
+{
+  return SquirrelMemory::allocate(static_cast<size_t>(size));
+}
+
+void* sq_vm_realloc(void* p, SQUnsignedInteger oldsize, SQUnsignedInteger size)
+{
+  return SquirrelMemory::reallocate(p, static_cast<size_t>(oldsize), static_cast<size_t>(size));
+}
+
+void sq_vm_free(void* p, SQUnsignedInteger size)
+{
+  SquirrelMemory::deallocate(p, static_cast<size_t>(size));
+}
+
+#endif
+
+/* EOF */
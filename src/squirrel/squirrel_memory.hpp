@@ -0,0 +1,61 @@
+//  SuperTux
+//  Copyright (C) 2020 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef HEADER_SUPERTUX_SQUIRREL_SQUIRREL_MEMORY_HPP
+#define HEADER_SUPERTUX_SQUIRREL_SQUIRREL_MEMORY_HPP
+
+#include <stddef.h>
+
+/** Allocator used by the Squirrel VM through sq_vm_malloc(),
+    sq_vm_realloc() and sq_vm_free(). Squirrel passes the block size
+    on every free, so small blocks (strings, closures, table nodes,
+    ...) are served from per-size free lists without any header,
+    larger ones go straight to malloc(). Only active when squirrel is
+    built with SQ_EXCLUDE_DEFAULT_MEMFUNCTIONS, see
+    ENABLE_SQUIRREL_POOL. */
+class SquirrelMemory final
+{
+public:
+  struct Stats
+  {
+    /** Bytes currently allocated by the VM */
+    size_t heap_size;
+
+    /** Number of allocations since startup */
+    size_t allocation_count;
+
+    /** Bytes reserved for the small block pools */
+    size_t pool_size;
+  };
+
+public:
+  static void* allocate(size_t size);
+  static void* reallocate(void* ptr, size_t old_size, size_t size);
+  static void deallocate(void* ptr, size_t size);
+
+  static Stats get_stats();
+
+  /** Returns false when squirrel uses its builtin allocator and no
+      stats are collected */
+  static bool is_enabled();
+
+private:
+  SquirrelMemory() = delete;
+};
+
+#endif
+
+/* EOF */
@@ -17,51 +17,120 @@
 #include "squirrel/squirrel_scheduler.hpp"
 
 #include <algorithm>
+#include <math.h>
 
 #include "squirrel/squirrel_virtual_machine.hpp"
 #include "squirrel/squirrel_util.hpp"
+#include "supertux/constants.hpp"
 #include "util/log.hpp"
 
+const float SquirrelScheduler::TICK = 1.0f / LOGICAL_FPS;
+
+int SquirrelScheduler::s_total_suspended_count = 0;
+int SquirrelScheduler::s_frame_wakeup_count = 0;
+int SquirrelScheduler::s_last_frame_wakeup_count = 0;
+
 SquirrelScheduler::SquirrelScheduler(SquirrelVM& vm) :
   m_vm(vm),
-  schedule()
+  m_wheel(WHEEL_SIZE),
+  m_current_tick(0),
+  m_suspended_count(0)
+{
+}
+
+SquirrelScheduler::~SquirrelScheduler()
+{
+  for (auto& slot : m_wheel) {
+    for (auto& entry : slot) {
+      sq_release(m_vm.get_vm(), &entry.thread_ref);
+    }
+  }
+  s_total_suspended_count -= m_suspended_count;
+}
+
+void
+SquirrelScheduler::new_frame()
+{
+  s_last_frame_wakeup_count = s_frame_wakeup_count;
+  s_frame_wakeup_count = 0;
+}
+
+int64_t
+SquirrelScheduler::time_to_tick(float time)
+{
+  return std::max<int64_t>(static_cast<int64_t>(floorf(time / TICK)), 0);
+}
+
+size_t
+SquirrelScheduler::get_slot(int64_t tick)
 {
+  return static_cast<size_t>(tick % WHEEL_SIZE);
 }
 
 void
 SquirrelScheduler::update(float time)
 {
-  while (!schedule.empty() && schedule.front().wakeup_time < time) {
-    HSQOBJECT thread_ref = schedule.front().thread_ref;
-
-    sq_pushobject(m_vm.get_vm(), thread_ref);
-    sq_getweakrefval(m_vm.get_vm(), -1);
-
-    HSQUIRRELVM scheduled_vm;
-    if (sq_gettype(m_vm.get_vm(), -1) == OT_THREAD &&
-       SQ_SUCCEEDED(sq_getthread(m_vm.get_vm(), -1, &scheduled_vm))) {
-      if (SQ_FAILED(sq_wakeupvm(scheduled_vm, SQFalse, SQFalse, SQTrue, SQFalse))) {
-        std::ostringstream msg;
-        msg << "Error waking VM: ";
-        sq_getlasterror(scheduled_vm);
-        if (sq_gettype(scheduled_vm, -1) != OT_STRING) {
-          msg << "(no info)";
-        } else {
-          const char* lasterr;
-          sq_getstring(scheduled_vm, -1, &lasterr);
-          msg << lasterr;
-        }
-        log_warning << msg.str() << std::endl;
-        sq_pop(scheduled_vm, 1);
+  const int64_t tick = time_to_tick(time);
+
+  // the slot of the current tick is visited again, as it can still
+  // hold threads that are due later in the tick, after a jump of more
+  // than a full turn every slot is visited once
+  const int64_t first_tick = std::max(m_current_tick, tick - WHEEL_SIZE + 1);
+  m_current_tick = std::max(m_current_tick, tick);
+
+  if (m_suspended_count == 0)
+    return;
+
+  for (int64_t t = first_tick; t <= tick; ++t) {
+    auto& slot = m_wheel[get_slot(t)];
+    if (slot.empty())
+      continue;
+
+    // waking up a thread can schedule new ones in the same slot
+    std::vector<ScheduleEntry> entries;
+    entries.swap(slot);
+
+    for (auto& entry : entries) {
+      if (entry.wakeup_time < time) {
+        m_suspended_count -= 1;
+        s_total_suspended_count -= 1;
+        wakeup(entry.thread_ref);
+      } else {
+        slot.push_back(entry);
       }
     }
+  }
+}
 
-    sq_release(m_vm.get_vm(), &thread_ref);
-    sq_pop(m_vm.get_vm(), 2);
+void
+SquirrelScheduler::wakeup(HSQOBJECT& thread_ref)
+{
+  s_frame_wakeup_count += 1;
+
+  sq_pushobject(m_vm.get_vm(), thread_ref);
+  sq_getweakrefval(m_vm.get_vm(), -1);
 
-    std::pop_heap(schedule.begin(), schedule.end());
-    schedule.pop_back();
+  HSQUIRRELVM scheduled_vm;
+  if (sq_gettype(m_vm.get_vm(), -1) == OT_THREAD &&
+     SQ_SUCCEEDED(sq_getthread(m_vm.get_vm(), -1, &scheduled_vm))) {
+    if (SQ_FAILED(sq_wakeupvm(scheduled_vm, SQFalse, SQFalse, SQTrue, SQFalse))) {
+      std::ostringstream msg;
+      msg << "Error waking VM: ";
+      sq_getlasterror(scheduled_vm);
+      if (sq_gettype(scheduled_vm, -1) != OT_STRING) {
+        msg << "(no info)";
+      } else {
+        const char* lasterr;
+        sq_getstring(scheduled_vm, -1, &lasterr);
+        msg << lasterr;
+      }
+      log_warning << msg.str() << std::endl;
+      sq_pop(scheduled_vm, 1);
+    }
   }
+
+  sq_release(m_vm.get_vm(), &thread_ref);
+  sq_pop(m_vm.get_vm(), 2);
 }
 
 void
@@ -81,8 +150,11 @@ SquirrelScheduler::schedule_thread(HSQUIRRELVM scheduled_vm, float time)
   sq_addref(m_vm.get_vm(), & entry.thread_ref);
   sq_pop(m_vm.get_vm(), 2);
 
-  schedule.push_back(entry);
-  std::push_heap(schedule.begin(), schedule.end());
+  // threads that are already due go into the slot that is visited next
+  const int64_t tick = std::max(time_to_tick(time), m_current_tick);
+  m_wheel[get_slot(tick)].push_back(entry);
+  m_suspended_count += 1;
+  s_total_suspended_count += 1;
 }
 
 /* EOF */
@@ -17,6 +17,7 @@
 #ifndef HEADER_SUPERTUX_SQUIRREL_SQUIRREL_SCHEDULER_HPP
 #define HEADER_SUPERTUX_SQUIRREL_SQUIRREL_SCHEDULER_HPP
 
+#include <stdint.h>
 #include <vector>
 
 #include <squirrel.h>
@@ -24,35 +25,66 @@
 class SquirrelVM;
 
 /** This class keeps a list of squirrel threads that are scheduled for a certain
-    time. (the typical result of a wait() command in a squirrel script) */
+    time. (the typical result of a wait() command in a squirrel script)
+
+    Threads are kept in a timer wheel, scheduling a thread and waking
+    it up are O(1). Waits longer than one turn of the wheel stay in
+    their slot and are skipped until their turn comes. */
 class SquirrelScheduler final
 {
+public:
+  /** Length of a slot of the wheel in seconds, one logical frame */
+  static const float TICK;
+
+  /** Number of slots in the wheel, covering 4 seconds */
+  static const int WHEEL_SIZE = 256;
+
 public:
   SquirrelScheduler(SquirrelVM& vm);
+  ~SquirrelScheduler();
 
   /** time must be absolute time, not relative updates, i.e. g_game_time */
   void update(float time);
   void schedule_thread(HSQUIRRELVM vm, float time);
 
+  /** Number of threads waiting in this scheduler */
+  int get_suspended_count() const { return m_suspended_count; }
+
+  /** Number of threads waiting in all schedulers */
+  static int get_total_suspended_count() { return s_total_suspended_count; }
+
+  /** Number of threads woken up by all schedulers in the last frame */
+  static int get_wakeup_count() { return s_last_frame_wakeup_count; }
+
+  /** Starts counting the wakeups of a new frame */
+  static void new_frame();
+
 private:
   struct ScheduleEntry {
     /// weak reference to the squirrel vm object
     HSQOBJECT thread_ref;
     /// time when the thread should be woken up
     float wakeup_time;
-
-    bool operator<(const ScheduleEntry& other) const
-    {
-      // we need the smallest value on top
-      return wakeup_time > other.wakeup_time;
-    }
   };
 
+  void wakeup(HSQOBJECT& thread_ref);
+
+  static int64_t time_to_tick(float time);
+  static size_t get_slot(int64_t tick);
+
 private:
   SquirrelVM& m_vm;
 
-  typedef std::vector<ScheduleEntry> ScheduleHeap;
-  ScheduleHeap schedule;
+  std::vector<std::vector<ScheduleEntry> > m_wheel;
+
+  /** Tick up to which the wheel was processed */
+  int64_t m_current_tick;
+
+  int m_suspended_count;
+
+  static int s_total_suspended_count;
+  static int s_frame_wakeup_count;
+  static int s_last_frame_wakeup_count;
 
 private:
   SquirrelScheduler(const SquirrelScheduler&) = delete;
@@ -20,6 +20,8 @@
 #include <sqstdblob.h>
 #include <sqstdmath.h>
 #include <sqstdstring.h>
+#include <algorithm>
+#include <chrono>
 #include <cstring>
 #include <stdarg.h>
 #include <stdio.h>
@@ -27,6 +29,7 @@
 #include "physfs/ifile_stream.hpp"
 #include "scripting/wrapper.hpp"
 #include "squirrel/squirrel_error.hpp"
+#include "squirrel/squirrel_memory.hpp"
 #include "squirrel/squirrel_thread_queue.hpp"
 #include "squirrel/squirrel_scheduler.hpp"
 #include "squirrel_util.hpp"
@@ -43,6 +46,18 @@ HSQREMOTEDBG debugger = nullptr;
 
 namespace {
 
+/** Don't start a garbage collection with less idle time than this left in the frame */
+const float MIN_GC_IDLE_TIME = 0.004f;
+
+/** Heap growth since the last collection after which an unrequested collection is run */
+const size_t GC_HEAP_GROWTH = 4 * 1024 * 1024;
+
+/** A pending collection is run even without idle time once it waited
+    this many frames or the heap grew by this factor, as a game that
+    never reaches its target framerate has no idle time at all */
+const int GC_MAX_PENDING_FRAMES = 120;
+const size_t GC_FORCE_HEAP_FACTOR = 2;
+
 #ifdef __clang__
 __attribute__((__format__ (__printf__, 2, 0)))
 #endif
@@ -66,6 +81,11 @@ void printfunc(HSQUIRRELVM, const char* fmt, ...)
 
 SquirrelVirtualMachine::SquirrelVirtualMachine(bool enable_debugger) :
   m_vm(),
+  m_gc_requested(false),
+  m_heap_size_after_gc(0),
+  m_gc_pending_frames(0),
+  m_last_gc_time(0.0f),
+  m_gc_count(0),
   m_screenswitch_queue(),
   m_scheduler()
 {
@@ -135,6 +155,7 @@ void
 SquirrelVirtualMachine::update(float dt_sec)
 {
   update_debugger();
+  SquirrelScheduler::new_frame();
   m_scheduler->update(g_game_time);
 }
 
@@ -165,4 +186,33 @@ SquirrelVirtualMachine::wakeup_screenswitch()
   m_screenswitch_queue->wakeup();
 }
 
+void
+SquirrelVirtualMachine::request_garbage_collection()
+{
+  m_gc_requested = true;
+}
+
+void
+SquirrelVirtualMachine::collect_garbage(float idle_sec)
+{
+  const size_t heap_size = SquirrelMemory::get_stats().heap_size;
+  if (!m_gc_requested && heap_size < m_heap_size_after_gc + GC_HEAP_GROWTH)
+    return;
+
+  m_gc_pending_frames += 1;
+  const bool forced = m_gc_pending_frames >= GC_MAX_PENDING_FRAMES ||
+                      heap_size >= GC_FORCE_HEAP_FACTOR * std::max(m_heap_size_after_gc, GC_HEAP_GROWTH);
+  if (idle_sec < MIN_GC_IDLE_TIME && !forced)
+    return;
+
+  const auto start = std::chrono::steady_clock::now();
+  sq_collectgarbage(m_vm.get_vm());
+  m_last_gc_time = std::chrono::duration<float>(std::chrono::steady_clock::now() - start).count();
+
+  m_gc_requested = false;
+  m_gc_pending_frames = 0;
+  m_heap_size_after_gc = SquirrelMemory::get_stats().heap_size;
+  m_gc_count += 1;
+}
+
 /* EOF */
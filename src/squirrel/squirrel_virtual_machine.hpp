@@ -44,12 +44,32 @@ public:
   /** wakes up threads waiting for a screen switch event */
   void wakeup_screenswitch();
 
+  /** Requests a run of the garbage collector, it is done in the idle
+      time of a later frame instead of stalling the current one */
+  void request_garbage_collection();
+
+  /** Runs the garbage collector when it was requested or the VM heap
+      grew a lot since the last run, but only if idle_sec leaves
+      enough room for it or the run was put off for too long. Has to
+      be called once per frame. */
+  void collect_garbage(float idle_sec);
+
+  /** Duration of the last garbage collector run in seconds */
+  float get_last_gc_time() const { return m_last_gc_time; }
+  int get_gc_count() const { return m_gc_count; }
+
 private:
     void update_debugger();
 
 private:
   SquirrelVM m_vm;
 
+  bool m_gc_requested;
+  size_t m_heap_size_after_gc;
+  int m_gc_pending_frames;
+  float m_last_gc_time;
+  int m_gc_count;
+
   std::unique_ptr<SquirrelThreadQueue> m_screenswitch_queue;
   std::unique_ptr<SquirrelScheduler> m_scheduler;
 
@@ -29,6 +29,8 @@ CommandLineArguments::CommandLineArguments() :
   m_log_level(LOG_WARNING),
   datadir(),
   userdir(),
+  log_mute_categories(),
+  log_trace_file(),
   fullscreen_size(),
   fullscreen_refresh_rate(),
   window_size(),
@@ -77,6 +79,8 @@ CommandLineArguments::print_help(const char* arg0) const
     << _("  -v, --version                Show SuperTux version and quit") << "\n"
     << _("  --verbose                    Print verbose messages") << "\n"
     << _("  --debug                      Print extra verbose messages") << "\n"
+    << _("  --log-mute CATEGORY          Hide messages from the source directory CATEGORY, e.g. 'audio'") << "\n"
+    << _("  --log-trace FILE             Write all messages in binary form to FILE") << "\n"
     << _( "  --print-datadir              Print SuperTux's primary data directory.") << "\n"
     << "\n"
     << _("Video Options:") << "\n"
@@ -159,6 +163,22 @@ CommandLineArguments::parse_args(int argc, char** argv)
         m_log_level = LOG_INFO;
       }
     }
+    else if (arg == "--log-mute")
+    {
+      if (++i >= argc) {
+        throw std::runtime_error("--log-mute CATEGORY needs an argument");
+      } else {
+        log_mute_categories.push_back(argv[i]);
+      }
+    }
+    else if (arg == "--log-trace")
+    {
+      if (++i >= argc) {
+        throw std::runtime_error("--log-trace FILE needs an argument");
+      } else {
+        log_trace_file = argv[i];
+      }
+    }
     else if (arg == "--datadir")
     {
       if (i + 1 >= argc)
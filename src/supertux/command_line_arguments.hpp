@@ -47,6 +47,9 @@ public:
   boost::optional<std::string> datadir;
   boost::optional<std::string> userdir;
 
+  std::vector<std::string> log_mute_categories;
+  boost::optional<std::string> log_trace_file;
+
   boost::optional<Size> fullscreen_size;
   boost::optional<int> fullscreen_refresh_rate;
   boost::optional<Size> window_size;
@@ -16,8 +16,11 @@
 
 #include "supertux/console.hpp"
 
+#include <algorithm>
+
 #include "math/sizef.hpp"
 #include "physfs/ifile_stream.hpp"
+#include "squirrel/squirrel_environment.hpp"
 #include "squirrel/squirrel_virtual_machine.hpp"
 #include "squirrel/squirrel_util.hpp"
 #include "supertux/gameconfig.hpp"
@@ -31,8 +34,10 @@
 static const float FADE_SPEED = 1;
 
 ConsoleBuffer::ConsoleBuffer() :
-  m_lines(),
-  m_console(nullptr)
+  m_console(nullptr),
+  m_lines(MAX_LINES),
+  m_next_line(0),
+  m_line_count(0)
 {
 }
 
@@ -57,34 +62,79 @@ ConsoleBuffer::addLines(const std::string& s)
 }
 
 void
-ConsoleBuffer::addLine(const std::string& s_)
+ConsoleBuffer::addLine(const std::string& s)
 {
-  std::string s = s_;
-
   // output line to stderr
   std::cerr << s << std::endl;
 
-  // wrap long lines
-  std::string overflow;
-  int line_count = 0;
-  do {
-    m_lines.push_front(Font::wrap_to_chars(s, 99, &overflow));
-    line_count += 1;
-    s = overflow;
-  } while (s.length() > 0);
-
-  // trim scrollback buffer
-  while (m_lines.size() >= 1000)
+  store_line(s);
+}
+
+void
+ConsoleBuffer::poll_log()
+{
+  std::vector<LogConsoleLine> lines;
+  if (!log_take_console_lines(lines))
+    return;
+
+  bool open_console = false;
+  for (const auto& line : lines)
   {
-    m_lines.pop_back();
+    // already written to stderr by the logging thread
+    std::istringstream iss(line.text);
+    std::string s;
+    while (std::getline(iss, s, '\n'))
+    {
+      store_line(s);
+    }
+
+    if (line.level == LOG_WARNING || line.level == LOG_FATAL)
+      open_console = true;
   }
 
+  if (open_console && g_config && g_config->developer_mode &&
+      m_console && !m_console->hasFocus()) {
+    m_console->open();
+  }
+}
+
+void
+ConsoleBuffer::store_line(const std::string& s)
+{
+  // overwrite the oldest line once the buffer is full
+  Line& line = m_lines[m_next_line];
+  line.text = s;
+  line.rows.clear();
+
+  m_next_line = (m_next_line + 1) % MAX_LINES;
+  if (m_line_count < MAX_LINES)
+    m_line_count += 1;
+
   if (m_console)
   {
-    m_console->on_buffer_change(line_count);
+    m_console->on_buffer_change();
   }
 }
 
+const std::vector<std::string>&
+ConsoleBuffer::get_rows(int index)
+{
+  assert(index >= 0 && index < m_line_count);
+
+  Line& line = m_lines[(m_next_line - 1 - index + MAX_LINES) % MAX_LINES];
+  if (line.rows.empty())
+  {
+    // wrap long lines
+    std::string s = line.text;
+    std::string overflow;
+    do {
+      line.rows.push_back(Font::wrap_to_chars(s, 99, &overflow));
+      s = overflow;
+    } while (s.length() > 0);
+  }
+  return line.rows;
+}
+
 void
 ConsoleBuffer::flush(ConsoleStreamBuffer& buffer)
 {
@@ -113,6 +163,8 @@ Console::Console(ConsoleBuffer& buffer) :
   m_background2(Surface::from_file("images/engine/console2.png")),
   m_vm(nullptr),
   m_vm_object(),
+  m_root_names(),
+  m_root_names_size(-1),
   m_backgroundOffset(0),
   m_height(0),
   m_alpha(1.0),
@@ -134,16 +186,18 @@ Console::~Console()
 }
 
 void
-Console::on_buffer_change(int line_count)
+Console::on_buffer_change()
 {
-  // increase console height if necessary
+  // increase console height if necessary, by the rows the new line
+  // takes up, so it is only wrapped right away while the console is open
   if (m_stayOpen > 0 && m_height < 64)
   {
     if (m_height < 4)
     {
       m_height = 4;
     }
-    m_height += m_font->get_height() * static_cast<float>(line_count);
+    const size_t row_count = m_buffer.get_rows(0).size();
+    m_height += m_font->get_height() * static_cast<float>(row_count);
   }
 
   // reset console to full opacity
@@ -288,7 +342,7 @@ Console::move_cursor(int offset_)
 // TODO: Fix rough documentation
 namespace {
 
-void sq_insert_commands(std::list<std::string>& cmds, HSQUIRRELVM vm, const std::string& table_prefix, const std::string& search_prefix);
+void sq_insert_commands(std::vector<std::string>& cmds, HSQUIRRELVM vm, const std::string& table_prefix, const std::string& search_prefix);
 
 /**
  * Acts upon key,value on top of stack:
@@ -296,7 +350,7 @@ void sq_insert_commands(std::list<std::string>& cmds, HSQUIRRELVM vm, const std:
  * Calls sq_insert_commands if search_prefix starts with table_prefix+key (and value is a table/class/instance);
  */
 void
-sq_insert_command(std::list<std::string>& cmds, HSQUIRRELVM vm, const std::string& table_prefix, const std::string& search_prefix)
+sq_insert_command(std::vector<std::string>& cmds, HSQUIRRELVM vm, const std::string& table_prefix, const std::string& search_prefix)
 {
   const SQChar* key_chars;
   if (SQ_FAILED(sq_getstring(vm, -2, &key_chars))) return;
@@ -336,7 +390,7 @@ sq_insert_command(std::list<std::string>& cmds, HSQUIRRELVM vm, const std::strin
  * calls sq_insert_command for all entries of table/class on top of stack
  */
 void
-sq_insert_commands(std::list<std::string>& cmds, HSQUIRRELVM vm, const std::string& table_prefix, const std::string& search_prefix)
+sq_insert_commands(std::vector<std::string>& cmds, HSQUIRRELVM vm, const std::string& table_prefix, const std::string& search_prefix)
 {
   sq_pushnull(vm); // push iterator
   while (SQ_SUCCEEDED(sq_next(vm,-2))) {
@@ -346,9 +400,124 @@ sq_insert_commands(std::list<std::string>& cmds, HSQUIRRELVM vm, const std::stri
   sq_pop(vm, 1); // pop iterator
 }
 
+/**
+ * calls func for the root table and each of its delegates, with the table on top of stack
+ */
+template<typename F>
+void
+sq_for_each_root_table(HSQUIRRELVM vm, F func)
+{
+  sq_pushroottable(vm);
+  while (sq_gettype(vm, -1) == OT_TABLE) {
+    func();
+
+    // cycle through parent(delegate) table
+    if (SQ_FAILED(sq_getdelegate(vm, -1))) {
+      break;
+    }
+    sq_remove(vm, -2); // remove old table
+  }
+  sq_pop(vm, 1); // remove table
+}
+
 }
 // End of Console::autocomplete helper functions
 
+void
+Console::update_root_names()
+{
+  // Squirrel can't report changes to a table, so the size has to do
+  SQInteger size = 0;
+  sq_for_each_root_table(m_vm, [this, &size]{
+      size += sq_getsize(m_vm, -1);
+    });
+
+  if (size == m_root_names_size)
+    return;
+
+  std::vector<std::string> names;
+  sq_for_each_root_table(m_vm, [this, &names]{
+      sq_insert_commands(names, m_vm, "", "");
+    });
+
+  m_root_names.clear();
+  for (const auto& name : names) {
+    m_root_names.add(name);
+  }
+  m_root_names_size = size;
+}
+
+void
+Console::find_completions(const std::string& prefix, std::vector<std::string>& cmds)
+{
+  const std::string::size_type last_dot = prefix.rfind('.');
+  if (last_dot == std::string::npos)
+  {
+    update_root_names();
+    m_root_names.find(prefix, cmds);
+    return;
+  }
+
+  // look up the object in front of the last dot, only its members are
+  // candidates
+  const std::string table_prefix = prefix.substr(0, last_dot + 1);
+  SQInteger oldtop = sq_gettop(m_vm);
+  sq_pushroottable(m_vm);
+  for (std::string::size_type start = 0; start <= last_dot;) {
+    const std::string::size_type end = prefix.find('.', start);
+    const std::string key = prefix.substr(start, end - start);
+    sq_pushstring(m_vm, key.c_str(), static_cast<SQInteger>(key.length()));
+    if (SQ_FAILED(sq_get(m_vm, -2))) {
+      sq_settop(m_vm, oldtop);
+      return;
+    }
+    sq_remove(m_vm, -2);
+    start = end + 1;
+  }
+
+  HSQOBJECT object;
+  sq_resetobject(&object);
+  sq_getstackobj(m_vm, -1, &object);
+
+  // exposed game objects come and go, the environment keeps track of
+  // them, names defined by scripts are only found by walking the table
+  if (auto environment = SquirrelEnvironment::from_table(object))
+  {
+    const PrefixTrie& exposed_names = environment->get_exposed_names();
+    std::vector<std::string> names;
+    exposed_names.find(prefix.substr(last_dot + 1), names);
+    for (const auto& name : names) {
+      cmds.push_back(table_prefix + name);
+    }
+
+    names.clear();
+    sq_insert_commands(names, m_vm, table_prefix, prefix);
+    for (const auto& name : names) {
+      if (!exposed_names.contains(name.substr(table_prefix.size()))) {
+        cmds.push_back(name);
+      }
+    }
+    std::sort(cmds.begin(), cmds.end());
+  }
+  else
+  {
+    switch (sq_gettype(m_vm, -1)) {
+      case OT_INSTANCE:
+        sq_getclass(m_vm, -1);
+        sq_insert_commands(cmds, m_vm, table_prefix, prefix);
+        break;
+      case OT_TABLE:
+      case OT_CLASS:
+        sq_insert_commands(cmds, m_vm, table_prefix, prefix);
+        break;
+      default:
+        break;
+    }
+    std::sort(cmds.begin(), cmds.end());
+  }
+  sq_settop(m_vm, oldtop);
+}
+
 void
 Console::autocomplete()
 {
@@ -362,24 +531,10 @@ Console::autocomplete()
   std::string prefix = m_inputBuffer.substr(autocompleteFrom, m_inputBufferPosition - autocompleteFrom);
   m_buffer.addLines("> " + prefix);
 
-  std::list<std::string> cmds;
+  std::vector<std::string> cmds;
 
   ready_vm();
-
-  // append all keys of the current root table to list
-  sq_pushroottable(m_vm); // push root table
-  while (true) {
-    // check all keys (and their children) for matches
-    sq_insert_commands(cmds, m_vm, "", prefix);
-
-    // cycle through parent(delegate) table
-    SQInteger oldtop = sq_gettop(m_vm);
-    if (SQ_FAILED(sq_getdelegate(m_vm, -1)) || oldtop == sq_gettop(m_vm)) {
-      break;
-    }
-    sq_remove(m_vm, -2); // remove old table
-  }
-  sq_pop(m_vm, 1); // remove table
+  find_completions(prefix, cmds);
 
   // depending on number of hits, show matches or autocomplete
   if (cmds.empty())
@@ -399,9 +554,7 @@ Console::autocomplete()
   {
     // multiple matches: show all matches and set input buffer to longest common prefix
     std::string commonPrefix = cmds.front();
-    while (cmds.begin() != cmds.end()) {
-      std::string cmd = cmds.front();
-      cmds.pop_front();
+    for (const auto& cmd : cmds) {
       m_buffer.addLines(cmd);
       for (int n = static_cast<int>(commonPrefix.length()); n >= 1; n--) {
         if (cmd.compare(0, n, commonPrefix) != 0) commonPrefix.resize(n-1); else break;
@@ -502,6 +655,8 @@ Console::toggle()
 void
 Console::update(float dt_sec)
 {
+  m_buffer.poll_log();
+
   if (m_stayOpen > 0) {
     m_stayOpen -= dt_sec;
     if (m_stayOpen < 0)
@@ -574,14 +729,32 @@ Console::draw(DrawingContext& context) const
     }
   }
 
+  // only the lines that end up on screen get wrapped and drawn
   int skipLines = -m_offset;
-  for (std::list<std::string>::iterator i = m_buffer.m_lines.begin(); i != m_buffer.m_lines.end(); ++i)
+  for (int i = 0; i < m_buffer.get_line_count(); ++i)
   {
-    if (skipLines-- > 0) continue;
-    lineNo++;
-    float py = static_cast<float>(m_height - 4.0f - static_cast<float>(lineNo) * m_font->get_height());
-    if (py < -m_font->get_height()) break;
-    context.color().draw_text(m_font, *i, Vector(4.0f, py), ALIGN_LEFT, layer);
+    const auto& rows = m_buffer.get_rows(i);
+    if (skipLines >= static_cast<int>(rows.size()))
+    {
+      skipLines -= static_cast<int>(rows.size());
+      continue;
+    }
+
+    bool visible = true;
+    for (auto row = rows.rbegin() + skipLines; row != rows.rend(); ++row)
+    {
+      lineNo++;
+      float py = static_cast<float>(m_height - 4.0f - static_cast<float>(lineNo) * m_font->get_height());
+      if (py < -m_font->get_height())
+      {
+        visible = false;
+        break;
+      }
+      context.color().draw_text(m_font, *row, Vector(4.0f, py), ALIGN_LEFT, layer);
+    }
+    skipLines = 0;
+
+    if (!visible) break;
   }
   context.pop_transform();
 }
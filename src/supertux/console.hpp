@@ -23,6 +23,7 @@
 #include <vector>
 
 #include "util/currenton.hpp"
+#include "util/prefix_trie.hpp"
 #include "video/font_ptr.hpp"
 #include "video/surface_ptr.hpp"
 
@@ -36,8 +37,9 @@ public:
   static std::ostream output; /**< stream of characters to output to the console. Do not forget to send std::endl or to flush the stream. */
   static ConsoleStreamBuffer s_outputBuffer; /**< stream buffer used by output stream */
 
+  static const int MAX_LINES = 1000; /**< size of the scrollback buffer */
+
 public:
-  std::list<std::string> m_lines; /**< backbuffer of lines sent to the console. New lines get added to front. */
   Console* m_console;
 
 public:
@@ -46,10 +48,32 @@ public:
   void addLines(const std::string& s); /**< display a string of (potentially) multiple lines in the console */
   void addLine(const std::string& s); /**< display a line in the console */
 
+  void poll_log(); /**< display the messages that the logging thread wrote since the last call */
+
   void flush(ConsoleStreamBuffer& buffer); /**< act upon changes in a ConsoleStreamBuffer */
 
   void set_console(Console* console);
 
+  int get_line_count() const { return m_line_count; } /**< number of lines in the scrollback buffer */
+
+  /** rows of the given line wrapped to the console width, 0 is the
+      newest line; lines are only wrapped when they are first drawn */
+  const std::vector<std::string>& get_rows(int index);
+
+private:
+  void store_line(const std::string& s); /**< like addLine(), but without echoing to stderr */
+
+private:
+  struct Line
+  {
+    std::string text;
+    std::vector<std::string> rows; /**< empty until wrapped */
+  };
+
+  std::vector<Line> m_lines; /**< ring buffer of lines sent to the console, strings are reused once it wrapped around */
+  int m_next_line; /**< slot in m_lines that is written next */
+  int m_line_count;
+
 private:
   ConsoleBuffer(const ConsoleBuffer&) = delete;
   ConsoleBuffer& operator=(const ConsoleBuffer&) = delete;
@@ -61,7 +85,8 @@ public:
   Console(ConsoleBuffer& buffer);
   ~Console();
 
-  void on_buffer_change(int line_count);
+  /** Called by the ConsoleBuffer after it stored a new line */
+  void on_buffer_change();
 
   void input(char c); /**< add character to inputBuffer */
   void backspace(); /**< delete character left of inputBufferPosition */
@@ -97,6 +122,9 @@ private:
   HSQUIRRELVM m_vm; /**< squirrel thread for the console (with custom roottable) */
   HSQOBJECT m_vm_object;
 
+  PrefixTrie m_root_names; /**< completions for the root table and its delegates */
+  SQInteger m_root_names_size; /**< number of entries in those tables when m_root_names was filled */
+
   int m_backgroundOffset; /**< current offset of scrolling background image */
   float m_height; /**< height of the console in px */
   float m_alpha;
@@ -111,6 +139,12 @@ private:
   /** ready a virtual machine instance, creating a new thread and loading default .nut files if needed */
   void ready_vm();
 
+  /** refill m_root_names if the root tables changed since the last call */
+  void update_root_names();
+
+  /** append all completions of @c prefix to @c cmds */
+  void find_completions(const std::string& prefix, std::vector<std::string>& cmds);
+
   /** execute squirrel script and output result */
   void execute_script(const std::string& s);
 
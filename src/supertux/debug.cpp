@@ -25,6 +25,8 @@ Debug::Debug() :
   show_collision_rects(false),
   show_worldmap_path(false),
   show_controller(false),
+  show_script_stats(false),
+  show_render_stats(false),
   m_use_bitmap_fonts(false),
   m_game_speed_multiplier(1.0f)
 {
@@ -37,6 +37,12 @@ public:
 
   bool show_controller;
 
+  /** Show memory and garbage collector stats of the script VM */
+  bool show_script_stats;
+
+  /** Show the number of GL calls that are made per frame */
+  bool show_render_stats;
+
 private:
   /** Use old bitmap fonts instead of TTF */
   bool m_use_bitmap_fonts;
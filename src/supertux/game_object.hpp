@@ -67,6 +67,15 @@ public:
       in pause mode). This function is not called in the Editor. */
   virtual void update(float dt_sec) = 0;
 
+  /** Returns true if update() only reads other objects and only
+      writes the state of this object. It must not create objects,
+      play sounds, run scripts, log or use the random number
+      generators. Such objects may be updated on another thread,
+      before all other objects. Looking up other objects with
+      get_objects_by_type() is fine, but takes a lock in that phase,
+      so it shouldn't be done for every object in every frame. */
+  virtual bool is_update_parallel_safe() const { return false; }
+
   /** The GameObject should draw itself onto the provided
       DrawingContext if this function is called. */
   virtual void draw(DrawingContext& context) = 0;
@@ -21,55 +21,39 @@
 
 #include "game_object_manager.hpp"
 
+/** Iterates over the objects of a type registry, every element is
+    known to be a T, so no objects have to be skipped */
 template<typename T>
 class GameObjectIterator
 {
 public:
-  typedef std::vector<std::unique_ptr<GameObject> >::const_iterator Iterator;
+  typedef std::vector<GameObject*>::const_iterator Iterator;
 
 public:
-  GameObjectIterator(Iterator it, Iterator end) :
-    m_it(it),
-    m_end(end),
-    m_object()
+  GameObjectIterator(Iterator it) :
+    m_it(it)
   {
-    if (m_it != m_end)
-    {
-      m_object = dynamic_cast<T*>(m_it->get());
-      if (!m_object)
-      {
-        skip_to_next();
-      }
-    }
   }
 
   GameObjectIterator& operator++()
   {
-    skip_to_next();
+    ++m_it;
     return *this;
   }
 
   GameObjectIterator operator++(int)
   {
     GameObjectIterator tmp(*this);
-    skip_to_next();
+    ++m_it;
     return tmp;
   }
 
-  T* operator->() {
-    return m_object;
-  }
-
-  const T* operator->() const {
-    return m_object;
+  T* operator->() const {
+    return GameObjectCast<T>::cast(*m_it);
   }
 
   T& operator*() const {
-    return *m_object;
-  }
-
-  T& operator*() {
-    return *m_object;
+    return *GameObjectCast<T>::cast(*m_it);
   }
 
   bool operator==(const GameObjectIterator& other) const
@@ -82,28 +66,8 @@ public:
     return !(*this == other);
   }
 
-private:
-  void skip_to_next()
-  {
-    do
-    {
-      ++m_it;
-      if (m_it == m_end)
-      {
-        break;
-      }
-      else
-      {
-        m_object = dynamic_cast<T*>(m_it->get());
-      }
-    }
-    while (!m_object);
-  }
-
 private:
   Iterator m_it;
-  Iterator m_end;
-  T* m_object;
 };
 
 template<typename T>
@@ -111,19 +75,19 @@ class GameObjectRange
 {
 public:
   GameObjectRange(const GameObjectManager& manager) :
-    m_manager(manager)
+    m_objects(manager.get_objects_by_base_type<T>())
   {}
 
   GameObjectIterator<T> begin() const {
-    return GameObjectIterator<T>(m_manager.get_objects().begin(), m_manager.get_objects().end());
+    return GameObjectIterator<T>(m_objects.begin());
   }
 
   GameObjectIterator<T> end() const {
-    return GameObjectIterator<T>(m_manager.get_objects().end(), m_manager.get_objects().end());
+    return GameObjectIterator<T>(m_objects.end());
   }
 
 private:
-  const GameObjectManager& m_manager;
+  const std::vector<GameObject*>& m_objects;
 };
 
 #endif
@@ -18,8 +18,25 @@
 #include "supertux/game_object_manager.hpp"
 
 #include <algorithm>
+#include <thread>
 
 #include "object/tilemap.hpp"
+#include "supertux/gameconfig.hpp"
+#include "supertux/globals.hpp"
+#include "util/thread_pool.hpp"
+
+namespace {
+
+/** Below this the threads cost more than they save */
+const size_t MIN_PARALLEL_OBJECTS = 8;
+
+ThreadPool& get_update_pool()
+{
+  static ThreadPool pool(std::max(1, static_cast<int>(std::thread::hardware_concurrency()) - 1));
+  return pool;
+}
+
+} // namespace
 
 bool GameObjectManager::s_draw_solids_only = false;
 
@@ -31,7 +48,11 @@ GameObjectManager::GameObjectManager() :
   m_objects_by_name(),
   m_objects_by_uid(),
   m_objects_by_type_index(),
-  m_name_resolve_requests()
+  m_objects_by_base_type(),
+  m_objects_by_base_type_mutex(),
+  m_parallel_update_running(false),
+  m_name_resolve_requests(),
+  m_parallel_objects()
 {
 }
 
@@ -107,14 +128,51 @@ GameObjectManager::clear_objects()
     before_object_remove(*obj);
   }
   m_gameobjects.clear();
+  m_objects_by_base_type.clear();
 }
 
 void
 GameObjectManager::update(float dt_sec)
 {
+  // These only write their own state, so their results don't depend
+  // on the order or on threads. They always go first, so that
+  // enabling threads doesn't change what the other objects see.
+  m_parallel_objects.clear();
   for (const auto& object : m_gameobjects)
   {
-    if (!object->is_valid())
+    if (object->is_valid() && object->is_update_parallel_safe())
+    {
+      m_parallel_objects.push_back(object.get());
+    }
+  }
+
+  if (g_config && g_config->parallel_update && m_parallel_objects.size() >= MIN_PARALLEL_OBJECTS)
+  {
+    m_parallel_update_running = true;
+    try
+    {
+      get_update_pool().parallel_for(m_parallel_objects.size(), [this, dt_sec](size_t i) {
+        m_parallel_objects[i]->update(dt_sec);
+      });
+    }
+    catch(...)
+    {
+      m_parallel_update_running = false;
+      throw;
+    }
+    m_parallel_update_running = false;
+  }
+  else
+  {
+    for (auto* object : m_parallel_objects)
+    {
+      object->update(dt_sec);
+    }
+  }
+
+  for (const auto& object : m_gameobjects)
+  {
+    if (!object->is_valid() || object->is_update_parallel_safe())
       continue;
 
     object->update(dt_sec);
@@ -205,6 +263,16 @@ GameObjectManager::this_before_object_add(GameObject& object)
   { // by_type_index
     m_objects_by_type_index[std::type_index(typeid(object))].push_back(&object);
   }
+
+  { // by_base_type
+    for (auto& it : m_objects_by_base_type)
+    {
+      if (it.second.matches(object))
+      {
+        it.second.objects.push_back(&object);
+      }
+    }
+  }
 }
 
 void
@@ -228,6 +296,36 @@ GameObjectManager::this_before_object_remove(GameObject& object)
     assert(it != vec.end());
     vec.erase(it);
   }
+
+  { // by_base_type
+    for (auto& it : m_objects_by_base_type)
+    {
+      if (it.second.matches(object))
+      {
+        auto& objects = it.second.objects;
+        auto obj_it = std::find(objects.begin(), objects.end(), &object);
+        if (obj_it != objects.end()) {
+          objects.erase(obj_it);
+        }
+      }
+    }
+  }
+}
+
+const std::vector<GameObject*>&
+GameObjectManager::register_base_type(std::type_index type_idx, bool (*matches)(GameObject& object)) const
+{
+  TypeRegistry& registry = m_objects_by_base_type[type_idx];
+  registry.matches = matches;
+  for (const auto& obj : m_gameobjects)
+  {
+    // skip the slots that flush_game_objects() is moving around
+    if (obj && matches(*obj))
+    {
+      registry.objects.push_back(obj.get());
+    }
+  }
+  return registry.objects;
 }
 
 float
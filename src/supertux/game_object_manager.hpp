@@ -19,6 +19,8 @@
 #define HEADER_SUPERTUX_SUPERTUX_GAME_OBJECT_MANAGER_HPP
 
 #include <functional>
+#include <mutex>
+#include <type_traits>
 #include <typeindex>
 #include <unordered_map>
 #include <vector>
@@ -31,6 +33,20 @@ class TileMap;
 
 template<class T> class GameObjectRange;
 
+/** Casts a GameObject that is known to be a T, types like Portable
+    that aren't derived from GameObject need a dynamic_cast */
+template<class T, bool = std::is_base_of<GameObject, T>::value>
+struct GameObjectCast
+{
+  static T* cast(GameObject* object) { return static_cast<T*>(object); }
+};
+
+template<class T>
+struct GameObjectCast<T, false>
+{
+  static T* cast(GameObject* object) { return dynamic_cast<T*>(object); }
+};
+
 class GameObjectManager
 {
 public:
@@ -43,6 +59,19 @@ private:
     std::function<void (UID)> callback;
   };
 
+  /** All objects that are a given type or derived from it */
+  struct TypeRegistry
+  {
+    bool (*matches)(GameObject& object);
+    std::vector<GameObject*> objects;
+  };
+
+  template<class T>
+  static bool is_a(GameObject& object)
+  {
+    return dynamic_cast<T*>(&object) != nullptr;
+  }
+
 public:
   GameObjectManager();
   virtual ~GameObjectManager();
@@ -60,6 +89,9 @@ public:
     return obj_ref;
   }
 
+  /** Updates the objects that declare is_update_parallel_safe()
+      first, on several threads if 'parallel_update' is enabled in
+      the config, then all other objects in their usual order */
   void update(float dt_sec);
   void draw(DrawingContext& context);
 
@@ -89,6 +121,26 @@ public:
     return GameObjectRange<T>(*this);
   }
 
+  /** Returns the objects that are a T or derived from it, in the
+      order of get_objects(). The list is built on the first call for
+      a T and kept up to date from then on, so later calls only cost
+      the number of matches. */
+  template<class T>
+  const std::vector<GameObject*>& get_objects_by_base_type() const
+  {
+    if (m_parallel_update_running)
+    {
+      // workers may register a type at the same time, the returned
+      // list stays valid after unlocking as the map nodes never move
+      std::lock_guard<std::mutex> lock(m_objects_by_base_type_mutex);
+      return find_base_type(std::type_index(typeid(T)), &is_a<T>);
+    }
+    else
+    {
+      return find_base_type(std::type_index(typeid(T)), &is_a<T>);
+    }
+  }
+
   const std::vector<GameObject*>&
   get_objects_by_type_index(std::type_index type_idx) const
   {
@@ -165,10 +217,14 @@ public:
   template<class T>
   int get_object_count(std::function<bool(const T&)> predicate = nullptr) const
   {
+    const auto& objects = get_objects_by_base_type<T>();
+    if (predicate == nullptr) {
+      return static_cast<int>(objects.size());
+    }
+
     int total = 0;
-    for (const auto& obj : m_gameobjects) {
-      auto object = dynamic_cast<T*>(obj.get());
-      if (object && (predicate == nullptr || predicate(*object)))
+    for (const auto& obj : objects) {
+      if (predicate(*GameObjectCast<T>::cast(obj)))
       {
         total += 1;
       }
@@ -196,6 +252,20 @@ private:
   void this_before_object_add(GameObject& object);
   void this_before_object_remove(GameObject& object);
 
+  const std::vector<GameObject*>& find_base_type(std::type_index type_idx,
+                                                 bool (*matches)(GameObject& object)) const
+  {
+    auto it = m_objects_by_base_type.find(type_idx);
+    if (it == m_objects_by_base_type.end()) {
+      return register_base_type(type_idx, matches);
+    } else {
+      return it->second.objects;
+    }
+  }
+
+  const std::vector<GameObject*>& register_base_type(std::type_index type_idx,
+                                                     bool (*matches)(GameObject& object)) const;
+
 private:
   UIDGenerator m_uid_generator;
 
@@ -211,8 +281,18 @@ private:
   std::unordered_map<UID, GameObject*> m_objects_by_uid;
   std::unordered_map<std::type_index, std::vector<GameObject*> > m_objects_by_type_index;
 
+  /** Filled on demand by get_objects_by_base_type() */
+  mutable std::unordered_map<std::type_index, TypeRegistry> m_objects_by_base_type;
+
+  /** Guards m_objects_by_base_type while m_parallel_update_running */
+  mutable std::mutex m_objects_by_base_type_mutex;
+  bool m_parallel_update_running;
+
   std::vector<NameResolveRequest> m_name_resolve_requests;
 
+  /** Objects updated in the parallel phase, reused every frame */
+  std::vector<GameObject*> m_parallel_objects;
+
 private:
   GameObjectManager(const GameObjectManager&) = delete;
   GameObjectManager& operator=(const GameObjectManager&) = delete;
@@ -116,7 +116,24 @@ GameSession::restart_level(bool after_death)
 
   try {
     m_old_level = std::move(m_level);
-    m_level = LevelParser::from_file(m_levelfile, false, false);
+
+    // The statistics need every sector to count the totals, so sectors
+    // can only be constructed on first entry when the totals are
+    // already known from a previous run of the level
+    const bool defer_sectors = m_best_level_statistics &&
+                               m_best_level_statistics->get_status() == Statistics::FINAL;
+    m_level = LevelParser::from_file(m_levelfile, false, false, defer_sectors);
+    if (m_level->get_deferred_sector_count() > 0) {
+      if (!m_level->m_checksum.empty() &&
+          m_level->m_checksum == m_best_level_statistics->get_level_checksum()) {
+        m_level->m_stats.init(*m_best_level_statistics);
+      } else {
+        // the level changed since the statistics were recorded, so the
+        // totals have to be counted again
+        m_level->construct_deferred_sectors();
+        m_level->m_stats.init(*m_level);
+      }
+    }
 
     if (!m_reset_sector.empty()) {
       m_currentsector = m_level->get_sector(m_reset_sector);
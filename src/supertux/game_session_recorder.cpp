@@ -17,6 +17,7 @@
 #include "supertux/game_session_recorder.hpp"
 
 #include <fstream>
+#include <string.h>
 
 #include "control/input_manager.hpp"
 #include "math/random.hpp"
@@ -24,6 +25,7 @@
 #include "supertux/game_session.hpp"
 #include "supertux/gameconfig.hpp"
 #include "supertux/globals.hpp"
+#include "supertux/moving_object.hpp"
 #include "supertux/sector.hpp"
 #include "util/log.hpp"
 
@@ -32,7 +34,9 @@ GameSessionRecorder::GameSessionRecorder() :
   m_capture_demo_stream(),
   m_playback_demo_stream(),
   m_demo_controller(),
-  m_playing(false)
+  m_playing(false),
+  m_playback_checksum(),
+  m_playback_steps()
 {
 }
 
@@ -113,6 +117,9 @@ GameSessionRecorder::play_demo(const std::string& filename)
 
   reset_demo_controller();
 
+  m_playback_checksum = 2166136261u;
+  m_playback_steps = 0;
+
   // skip over random seed, if it exists in the file
   char buf[30];                            // ascii decimal seed
   int seed;
@@ -153,6 +160,17 @@ GameSessionRecorder::process_events()
     m_playback_demo_stream->get(jump);
     m_playback_demo_stream->get(action);
 
+    if (!*m_playback_demo_stream)
+    {
+      log_info << "Demo finished after " << m_playback_steps << " steps, checksum "
+               << std::hex << m_playback_checksum << std::dec << std::endl;
+      m_playback_demo_stream.reset();
+      return;
+    }
+
+    update_playback_checksum();
+    m_playback_steps += 1;
+
     m_demo_controller->press(Control::LEFT, left != 0);
     m_demo_controller->press(Control::RIGHT, right != 0);
     m_demo_controller->press(Control::UP, up != 0);
@@ -175,4 +193,29 @@ GameSessionRecorder::process_events()
   }
 }
 
+void
+GameSessionRecorder::update_playback_checksum()
+{
+  // FNV-1a over the raw bits of the positions
+  auto add = [this](float value) {
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    for (int i = 0; i < 4; ++i)
+    {
+      m_playback_checksum ^= (bits >> (i * 8)) & 0xff;
+      m_playback_checksum *= 16777619u;
+    }
+  };
+
+  for (const auto& object : Sector::get().get_objects())
+  {
+    if (auto moving_object = dynamic_cast<const MovingObject*>(object.get()))
+    {
+      const Rectf& bbox = moving_object->get_bbox();
+      add(bbox.get_left());
+      add(bbox.get_top());
+    }
+  }
+}
+
 /* EOF */
@@ -18,6 +18,7 @@
 #define HEADER_SUPERTUX_SUPERTUX_GAME_SESSION_RECORDER_HPP
 
 #include <memory>
+#include <stdint.h>
 #include <string>
 
 #include "control/codecontroller.hpp"
@@ -43,6 +44,9 @@ public:
 private:
   void capture_demo_step();
 
+  /** Folds the position of every moving object into the checksum */
+  void update_playback_checksum();
+
 private:
   std::string m_capture_file;
   std::unique_ptr<std::ostream> m_capture_demo_stream;
@@ -50,6 +54,11 @@ private:
   std::unique_ptr<CodeController> m_demo_controller;
   bool m_playing;
 
+  /** Logged when the demo ends, playing the same demo must always
+      give the same checksum, with or without parallel updates */
+  uint32_t m_playback_checksum;
+  int m_playback_steps;
+
 private:
   GameSessionRecorder(const GameSessionRecorder&) = delete;
   GameSessionRecorder& operator=(const GameSessionRecorder&) = delete;
@@ -33,6 +33,8 @@ Config::Config() :
   use_fullscreen(false),
   video(VideoSystem::VIDEO_AUTO),
   try_vsync(true),
+  texture_budget(0),
+  texture_cache(false),
   show_fps(false),
   show_player_pos(false),
   sound_enabled(true),
@@ -53,6 +55,7 @@ Config::Config() :
   transitions_enabled(true),
   confirmation_dialog(false),
   pause_on_focusloss(true),
+  parallel_update(false),
   repository_url()
 {
 }
@@ -82,6 +85,7 @@ Config::load()
     }
   }
   config_mapping.get("transitions_enabled", transitions_enabled);
+  config_mapping.get("parallel_update", parallel_update);
   config_mapping.get("locale", locale);
   config_mapping.get("random_seed", random_seed);
   config_mapping.get("repository_url", repository_url);
@@ -94,6 +98,12 @@ Config::load()
     config_video_mapping->get("video", video_string);
     video = VideoSystem::get_video_system(video_string);
     config_video_mapping->get("vsync", try_vsync);
+    config_video_mapping->get("texture_budget", texture_budget);
+    if (texture_budget < 0)
+    {
+      texture_budget = 0;
+    }
+    config_video_mapping->get("texture_cache", texture_cache);
 
     config_video_mapping->get("fullscreen_width",  fullscreen_size.width);
     config_video_mapping->get("fullscreen_height", fullscreen_size.height);
@@ -183,6 +193,7 @@ Config::save()
     writer.write("christmas", christmas_mode);
   }
   writer.write("transitions_enabled", transitions_enabled);
+  writer.write("parallel_update", parallel_update);
   writer.write("locale", locale);
   writer.write("repository_url", repository_url);
 
@@ -195,6 +206,8 @@ Config::save()
     writer.write("video", VideoSystem::get_video_string(video));
   }
   writer.write("vsync", try_vsync);
+  writer.write("texture_budget", texture_budget);
+  writer.write("texture_cache", texture_cache);
 
   writer.write("fullscreen_width",  fullscreen_size.width);
   writer.write("fullscreen_height", fullscreen_size.height);
@@ -57,6 +57,13 @@ public:
   bool use_fullscreen;
   VideoSystem::Enum video;
   bool try_vsync;
+
+  /** memory limit for textures in MiB, 0 for no limit */
+  int texture_budget;
+
+  /** keep decoded images in the user directory for the next start */
+  bool texture_cache;
+
   bool show_fps;
   bool show_player_pos;
   bool sound_enabled;
@@ -95,6 +102,9 @@ public:
   bool confirmation_dialog;
   bool pause_on_focusloss;
 
+  /** update objects that only change their own state on several threads */
+  bool parallel_update;
+
   std::string repository_url;
 
   bool is_christmas() const {
@@ -16,16 +16,16 @@
 
 #include "supertux/level.hpp"
 
-#include "badguy/goldbomb.hpp"
-#include "object/bonus_block.hpp"
-#include "object/coin.hpp"
 #include "physfs/util.hpp"
 #include "supertux/sector.hpp"
-#include "trigger/secretarea_trigger.hpp"
+#include "supertux/sector_parser.hpp"
 #include "util/file_system.hpp"
 #include "util/log.hpp"
+#include "util/reader_document.hpp"
+#include "util/reader_mapping.hpp"
 #include "util/writer.hpp"
 
+#include <algorithm>
 #include <physfs.h>
 
 Level* Level::s_current = nullptr;
@@ -37,10 +37,13 @@ Level::Level(bool worldmap) :
   m_contact(),
   m_license(),
   m_filename(),
+  m_checksum(),
   m_sectors(),
   m_stats(),
   m_target_time(),
-  m_tileset("images/tiles.strf")
+  m_tileset("images/tiles.strf"),
+  m_deferred_document(),
+  m_deferred_sectors()
 {
   s_current = this;
 }
@@ -48,6 +51,7 @@ Level::Level(bool worldmap) :
 Level::~Level()
 {
   m_sectors.clear();
+  m_deferred_sectors.clear();
 }
 
 void
@@ -149,14 +153,67 @@ Level::add_sector(std::unique_ptr<Sector> sector)
   }
 }
 
+void
+Level::add_deferred_sector(const std::string& name_, const sexp::Value& sx)
+{
+  auto same_name = [&name_](const DeferredSector& deferred) {
+    return deferred.name == name_;
+  };
+
+  if (std::any_of(m_deferred_sectors.begin(), m_deferred_sectors.end(), same_name) ||
+      std::any_of(m_sectors.begin(), m_sectors.end(),
+                  [&name_](const std::unique_ptr<Sector>& sector) {
+                    return sector->get_name() == name_;
+                  }))
+  {
+    throw std::runtime_error("Trying to add 2 sectors with same name");
+  }
+
+  m_deferred_sectors.push_back({name_, &sx});
+}
+
+Sector&
+Level::construct_deferred_sector(size_t idx)
+{
+  const DeferredSector deferred = m_deferred_sectors[idx];
+  m_deferred_sectors.erase(m_deferred_sectors.begin() + idx);
+
+  log_debug << "constructing deferred sector '" << deferred.name << "'" << std::endl;
+
+  auto sector = SectorParser::from_reader(*this, ReaderMapping(*m_deferred_document, *deferred.sx), false);
+  Sector& result = *sector;
+  m_sectors.push_back(std::move(sector));
+
+  if (m_deferred_sectors.empty()) {
+    m_deferred_document.reset();
+  }
+
+  return result;
+}
+
+void
+Level::construct_deferred_sectors()
+{
+  while (!m_deferred_sectors.empty()) {
+    construct_deferred_sector(0);
+  }
+}
+
 Sector*
-Level::get_sector(const std::string& name_) const
+Level::get_sector(const std::string& name_)
 {
   for (auto const& sector : m_sectors) {
     if (sector->get_name() == name_) {
       return sector.get();
     }
   }
+
+  for (size_t i = 0; i < m_deferred_sectors.size(); ++i) {
+    if (m_deferred_sectors[i].name == name_) {
+      return &construct_deferred_sector(i);
+    }
+  }
+
   return nullptr;
 }
 
@@ -177,31 +234,7 @@ Level::get_total_coins() const
 {
   int total_coins = 0;
   for (auto const& sector : m_sectors) {
-    for (const auto& o: sector->get_objects()) {
-      auto coin = dynamic_cast<Coin*>(o.get());
-      if (coin)
-      {
-        total_coins++;
-        continue;
-      }
-      auto block = dynamic_cast<BonusBlock*>(o.get());
-      if (block)
-      {
-        if (block->get_contents() == BonusBlock::Content::COIN)
-        {
-          total_coins += block->get_hit_counter();
-          continue;
-        } else if (block->get_contents() == BonusBlock::Content::RAIN ||
-                   block->get_contents() == BonusBlock::Content::EXPLODE)
-        {
-          total_coins += 10;
-          continue;
-        }
-      }
-      auto goldbomb = dynamic_cast<GoldBomb*>(o.get());
-      if (goldbomb)
-        total_coins += 10;
-    }
+    total_coins += sector->get_total_coins();
   }
   return total_coins;
 }
@@ -211,9 +244,7 @@ Level::get_total_badguys() const
 {
   int total_badguys = 0;
   for (auto const& sector : m_sectors) {
-    total_badguys += sector->get_object_count<BadGuy>([] (const BadGuy& badguy) {
-      return badguy.m_countMe;
-    });
+    total_badguys += sector->get_total_badguys();
   }
   return total_badguys;
 }
@@ -223,7 +254,7 @@ Level::get_total_secrets() const
 {
   int total_secrets = 0;
   for (auto const& sector : m_sectors) {
-    total_secrets += sector->get_object_count<SecretAreaTrigger>();
+    total_secrets += sector->get_total_secrets();
   }
   return total_secrets;
 }
@@ -19,10 +19,15 @@
 
 #include "supertux/statistics.hpp"
 
+class ReaderDocument;
 class ReaderMapping;
 class Sector;
 class Writer;
 
+namespace sexp {
+class Value;
+} // namespace sexp
+
 /** Represents a collection of Sectors running in a single GameSession.
 
     Each Sector in turn contains GameObjects, e.g. Badguys and Players. */
@@ -48,11 +53,20 @@ public:
   const std::string& get_name() const { return m_name; }
   const std::string& get_author() const { return m_author; }
 
-  Sector* get_sector(const std::string& name) const;
+  /** Returns the sector with the given name, constructing it first
+      if its construction was deferred by the LevelParser */
+  Sector* get_sector(const std::string& name);
 
+  /** Number of constructed sectors, deferred sectors are not counted */
   size_t get_sector_count() const;
   Sector* get_sector(size_t num) const;
 
+  /** Number of sectors that are parsed, but not yet constructed */
+  size_t get_deferred_sector_count() const { return m_deferred_sectors.size(); }
+
+  /** Constructs all sectors whose construction was deferred */
+  void construct_deferred_sectors();
+
   std::string get_tileset() const { return m_tileset; }
 
   int get_total_coins() const;
@@ -67,6 +81,9 @@ private:
   void save(Writer& writer);
   void load_old_format(const ReaderMapping& reader);
 
+  void add_deferred_sector(const std::string& name, const sexp::Value& sx);
+  Sector& construct_deferred_sector(size_t idx);
+
 public:
   bool m_is_worldmap;
   std::string m_name;
@@ -74,11 +91,23 @@ public:
   std::string m_contact;
   std::string m_license;
   std::string m_filename;
+  std::string m_checksum; /**< MD5 of the level file, empty if the level wasn't loaded from a file */
   std::vector<std::unique_ptr<Sector> > m_sectors;
   Statistics m_stats;
   float m_target_time;
   std::string m_tileset;
 
+private:
+  struct DeferredSector
+  {
+    std::string name;
+    const sexp::Value* sx;
+  };
+
+  /** Keeps the parsed level file alive while sectors are deferred */
+  std::unique_ptr<ReaderDocument> m_deferred_document;
+  std::vector<DeferredSector> m_deferred_sectors;
+
 private:
   Level(const Level&) = delete;
   Level& operator=(const Level&) = delete;
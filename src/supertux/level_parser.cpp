@@ -16,9 +16,11 @@
 
 #include "supertux/level_parser.hpp"
 
+#include <memory>
 #include <physfs.h>
 #include <sstream>
 
+#include "addon/md5.hpp"
 #include "supertux/level.hpp"
 #include "supertux/sector.hpp"
 #include "supertux/sector_parser.hpp"
@@ -27,6 +29,27 @@
 #include "util/reader_document.hpp"
 #include "util/reader_mapping.hpp"
 
+namespace {
+
+std::string get_file_checksum(const std::string& filename)
+{
+  std::unique_ptr<PHYSFS_File, int(*)(PHYSFS_File*)> file(PHYSFS_openRead(filename.c_str()), PHYSFS_close);
+  if (!file)
+    return std::string();
+
+  MD5 md5;
+  while (true)
+  {
+    unsigned char buffer[16 * 1024];
+    PHYSFS_sint64 len = PHYSFS_readBytes(file.get(), buffer, sizeof(buffer));
+    if (len <= 0) break;
+    md5.update(buffer, static_cast<unsigned int>(len));
+  }
+  return md5.hex_digest();
+}
+
+} // namespace
+
 std::string
 LevelParser::get_level_name(const std::string& filename)
 {
@@ -63,10 +86,10 @@ LevelParser::from_stream(std::istream& stream, const std::string& context, bool
 }
 
 std::unique_ptr<Level>
-LevelParser::from_file(const std::string& filename, bool worldmap, bool editable)
+LevelParser::from_file(const std::string& filename, bool worldmap, bool editable, bool defer_sectors)
 {
   auto level = std::make_unique<Level>(worldmap);
-  LevelParser parser(*level, worldmap, editable);
+  LevelParser parser(*level, worldmap, editable, defer_sectors);
   parser.load(filename);
   return level;
 }
@@ -114,10 +137,11 @@ LevelParser::from_nothing_worldmap(const std::string& basedir, const std::string
   return level;
 }
 
-LevelParser::LevelParser(Level& level, bool worldmap, bool editable) :
+LevelParser::LevelParser(Level& level, bool worldmap, bool editable, bool defer_sectors) :
   m_level(level),
   m_worldmap(worldmap),
-  m_editable(editable)
+  m_editable(editable),
+  m_defer_sectors(defer_sectors && !editable)
 {
 }
 
@@ -132,10 +156,14 @@ void
 LevelParser::load(const std::string& filepath)
 {
   m_level.m_filename = filepath;
+  m_level.m_checksum = get_file_checksum(filepath);
   register_translation_directory(filepath);
   try {
-    auto doc = ReaderDocument::from_file(filepath);
-    load(doc);
+    auto doc = std::make_unique<ReaderDocument>(ReaderDocument::from_file(filepath));
+    load(*doc);
+    if (m_level.get_deferred_sector_count() > 0) {
+      m_level.m_deferred_document = std::move(doc);
+    }
   } catch(std::exception& e) {
     std::stringstream msg;
     msg << "Problem when reading level '" << filepath << "': " << e.what();
@@ -170,8 +198,15 @@ LevelParser::load(const ReaderDocument& doc)
     auto iter = level.get_iter();
     while (iter.next()) {
       if (iter.get_key() == "sector") {
-        auto sector = SectorParser::from_reader(m_level, iter.as_mapping(), m_editable);
-        m_level.add_sector(std::move(sector));
+        auto mapping = iter.as_mapping();
+        std::string sector_name;
+        mapping.get("name", sector_name);
+        if (m_defer_sectors && sector_name != "main") {
+          m_level.add_deferred_sector(sector_name, iter.get_sexp());
+        } else {
+          auto sector = SectorParser::from_reader(m_level, mapping, m_editable);
+          m_level.add_sector(std::move(sector));
+        }
       }
     }
 
@@ -28,14 +28,18 @@ class LevelParser final
 {
 public:
   static std::unique_ptr<Level> from_stream(std::istream& stream, const std::string& context, bool worldmap, bool editable);
-  static std::unique_ptr<Level> from_file(const std::string& filename, bool worldmap, bool editable);
+  /** When defer_sectors is set, only the "main" sector is constructed
+      right away, all others are constructed on their first access
+      through Level::get_sector() */
+  static std::unique_ptr<Level> from_file(const std::string& filename, bool worldmap, bool editable,
+                                          bool defer_sectors = false);
   static std::unique_ptr<Level> from_nothing(const std::string& basedir);
   static std::unique_ptr<Level> from_nothing_worldmap(const std::string& basedir, const std::string& name);
 
   static std::string get_level_name(const std::string& filename);
 
 private:
-  LevelParser(Level& level, bool worldmap, bool editable);
+  LevelParser(Level& level, bool worldmap, bool editable, bool defer_sectors = false);
 
   void load(const ReaderDocument& doc);
   void load(std::istream& stream, const std::string& context);
@@ -47,6 +51,7 @@ private:
   Level& m_level;
   bool m_worldmap;
   bool m_editable;
+  bool m_defer_sectors;
 
 private:
   LevelParser(const LevelParser&) = delete;
@@ -24,6 +24,8 @@ LevelTransformer::~LevelTransformer()
 void
 LevelTransformer::transform(Level& level)
 {
+  level.construct_deferred_sectors();
+
   for (size_t i = 0; i < level.get_sector_count(); ++i) {
     transform_sector(*level.get_sector(i));
   }
@@ -28,6 +28,7 @@
 #include "supertux/screen_manager.hpp"
 #include "supertux/sector.hpp"
 #include "util/gettext.hpp"
+#include "util/translated_string.hpp"
 #include "video/compositor.hpp"
 
 #include <boost/format.hpp>
@@ -160,24 +161,31 @@ LevelIntro::draw(Compositor& compositor)
 
   if (m_best_level_statistics)
   {
+    static const TranslatedString s_best_level_statistics = TranslatedString("Best Level Statistics");
+    static const TranslatedString s_coins = TranslatedString("Coins");
+    static const TranslatedString s_badguys_killed = TranslatedString("Badguys killed");
+    static const TranslatedString s_secrets = TranslatedString("Secrets");
+    static const TranslatedString s_best_time = TranslatedString("Best time");
+    static const TranslatedString s_level_target_time = TranslatedString("Level target time");
+
     context.color().draw_center_text(Resources::normal_font,
-                                     std::string("- ") + _("Best Level Statistics") + std::string(" -"),
+                                     "- " + s_best_level_statistics.get() + " -",
                                      Vector(0, static_cast<float>(py)),
                                      LAYER_FOREGROUND1, s_stat_hdr_color);
 
     py += static_cast<int>(Resources::normal_font->get_height());
 
-    draw_stats_line(context, py, _("Coins"),
+    draw_stats_line(context, py, s_coins,
                     Statistics::coins_to_string(m_best_level_statistics->m_coins, stats.m_total_coins));
-    draw_stats_line(context, py, _("Badguys killed"),
+    draw_stats_line(context, py, s_badguys_killed,
                     Statistics::frags_to_string(m_best_level_statistics->m_badguys, stats.m_total_badguys));
-    draw_stats_line(context, py, _("Secrets"),
+    draw_stats_line(context, py, s_secrets,
                     Statistics::secrets_to_string(m_best_level_statistics->m_secrets, stats.m_total_secrets));
-    draw_stats_line(context, py, _("Best time"),
+    draw_stats_line(context, py, s_best_time,
                     Statistics::time_to_string(m_best_level_statistics->get_time()));
 
     if (m_level.m_target_time != 0.0f) {
-      draw_stats_line(context, py, _("Level target time"),
+      draw_stats_line(context, py, s_level_target_time,
                       Statistics::time_to_string(m_level.m_target_time));
     }
   }
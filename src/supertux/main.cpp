@@ -119,6 +119,28 @@ public:
   }
 };
 
+class LogSubsystem final
+{
+public:
+  LogSubsystem(const CommandLineArguments& args)
+  {
+    for (const auto& category : args.log_mute_categories) {
+      log_mute_category(category);
+    }
+
+    log_start_thread();
+
+    if (args.log_trace_file) {
+      log_set_trace_file(*args.log_trace_file);
+    }
+  }
+
+  ~LogSubsystem()
+  {
+    log_stop_thread();
+  }
+};
+
 Main::Main()
 {
 }
@@ -147,6 +169,8 @@ Main::init_tinygettext()
     FL_FreeLocale(&locale);
     g_dictionary_manager->set_language(language);
   }
+
+  invalidate_translations();
 }
 
 class PhysfsSubsystem final
@@ -570,6 +594,7 @@ Main::run(int argc, char** argv)
       return EXIT_FAILURE;
     }
 
+    LogSubsystem log_subsystem(args);
     PhysfsSubsystem physfs_subsystem(argv[0], args.datadir, args.userdir);
     physfs_subsystem.print_search_path();
 
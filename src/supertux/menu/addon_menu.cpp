@@ -115,6 +115,10 @@ AddonMenu::refresh()
 void
 AddonMenu::rebuild_menu()
 {
+  // All the add-on information is already in memory, so unlike the
+  // level menus there is nothing worth loading lazily via load_item(),
+  // long add-on lists only rely on Menu drawing the visible items and
+  // on the cached item widths
   clear();
   add_label(_("Add-ons"));
   add_hl();
@@ -30,9 +30,29 @@
 #include "util/file_system.hpp"
 #include "util/gettext.hpp"
 
+namespace {
+
+std::string make_entry_text(const std::string& title, bool solved)
+{
+  std::ostringstream out;
+  if (solved)
+  {
+    out << title << " [*]";
+  }
+  else
+  {
+    out << title << " [ ]";
+  }
+  return out.str();
+}
+
+} // namespace
+
 ContribLevelsetMenu::ContribLevelsetMenu(std::unique_ptr<World> world) :
   m_world(std::move(world)),
-  m_levelset()
+  m_levelset(),
+  m_solved(),
+  m_title_loaded()
 {
   assert(m_world->is_levelset());
 
@@ -47,20 +67,11 @@ ContribLevelsetMenu::ContribLevelsetMenu(std::unique_ptr<World> world) :
   for (int i = 0; i < m_levelset->get_num_levels(); ++i)
   {
     std::string filename = m_levelset->get_level_filename(i);
-    std::string full_filename = FileSystem::join(m_world->get_basedir(), filename);
-    std::string title = LevelParser::get_level_name(full_filename);
     LevelState level_state = state.get_level_state(filename);
 
-    std::ostringstream out;
-    if (level_state.solved)
-    {
-      out << title << " [*]";
-    }
-    else
-    {
-      out << title << " [ ]";
-    }
-    add_entry(i, out.str());
+    m_solved.push_back(level_state.solved);
+    m_title_loaded.push_back(false);
+    add_entry(i, make_entry_text(FileSystem::basename(filename), level_state.solved));
   }
 
   add_hl();
@@ -81,4 +92,22 @@ ContribLevelsetMenu::menu_action(MenuItem& item)
   }
 }
 
+bool
+ContribLevelsetMenu::load_item(MenuItem& item)
+{
+  const int id = item.get_id();
+  if (id < 0 || id >= static_cast<int>(m_title_loaded.size()) || m_title_loaded[id])
+    return false;
+
+  m_title_loaded[id] = true;
+
+  std::string full_filename = FileSystem::join(m_world->get_basedir(), m_levelset->get_level_filename(id));
+  std::string title = LevelParser::get_level_name(full_filename);
+  if (title.empty())
+    return false;
+
+  item.set_text(make_entry_text(title, m_solved[id]));
+  return true;
+}
+
 /* EOF */
@@ -28,10 +28,16 @@ private:
   std::unique_ptr<World> m_world;
   std::unique_ptr<Levelset> m_levelset;
 
+  /** Solved state of each level, the titles are only looked up once
+      they are needed, as that means parsing the level */
+  std::vector<bool> m_solved;
+  std::vector<bool> m_title_loaded;
+
 public:
   ContribLevelsetMenu(std::unique_ptr<World> current_world);
 
   void menu_action(MenuItem& item) override;
+  bool load_item(MenuItem& item) override;
 
 private:
   ContribLevelsetMenu(const ContribLevelsetMenu&) = delete;
@@ -65,6 +65,8 @@ DebugMenu::DebugMenu() :
   add_toggle(-1, _("Show Controller"), &g_debug.show_controller);
   add_toggle(-1, _("Show Framerate"), &g_config->show_fps);
   add_toggle(-1, _("Show Player Position"), &g_config->show_player_pos);
+  add_toggle(-1, _("Show Script Stats"), &g_debug.show_script_stats);
+  add_toggle(-1, _("Show Render Stats"), &g_debug.show_render_stats);
   add_toggle(-1, _("Use Bitmap Fonts"),
              []{ return g_debug.get_use_bitmap_fonts(); },
              [](bool value){ g_debug.set_use_bitmap_fonts(value); });
@@ -30,13 +30,15 @@
 #include "util/file_system.hpp"
 
 EditorLevelSelectMenu::EditorLevelSelectMenu() :
-  m_levelset()
+  m_levelset(),
+  m_title_loaded()
 {
   initialize();
 }
 
 EditorLevelSelectMenu::EditorLevelSelectMenu(std::unique_ptr<World> world) :
-  m_levelset()
+  m_levelset(),
+  m_title_loaded()
 {
   Editor::current()->set_world(std::move(world));
   initialize();
@@ -59,12 +61,10 @@ void EditorLevelSelectMenu::initialize() {
   }
   else
   {
+    m_title_loaded.resize(num_levels, false);
     for (int i = 0; i < num_levels; ++i)
     {
-      std::string filename = m_levelset->get_level_filename(i);
-      std::string full_filename = FileSystem::join(basedir, filename);
-      std::string title = LevelParser::get_level_name(full_filename);
-      add_entry(i, title);
+      add_entry(i, m_levelset->get_level_filename(i));
     }
   }
 
@@ -83,6 +83,25 @@ void EditorLevelSelectMenu::initialize() {
   add_back(_("Back"),-2);
 }
 
+bool
+EditorLevelSelectMenu::load_item(MenuItem& item)
+{
+  const int id = item.get_id();
+  if (id < 0 || id >= static_cast<int>(m_title_loaded.size()) || m_title_loaded[id])
+    return false;
+
+  m_title_loaded[id] = true;
+
+  auto basedir = Editor::current()->get_world()->get_basedir();
+  std::string full_filename = FileSystem::join(basedir, m_levelset->get_level_filename(id));
+  std::string title = LevelParser::get_level_name(full_filename);
+  if (title.empty())
+    return false;
+
+  item.set_text(title);
+  return true;
+}
+
 EditorLevelSelectMenu::~EditorLevelSelectMenu()
 {
   auto editor = Editor::current();
@@ -27,12 +27,17 @@ class EditorLevelSelectMenu final : public Menu
 private:
   std::unique_ptr<Levelset> m_levelset;
 
+  /** Level titles are only looked up once they are needed, as that
+      means parsing the whole level */
+  std::vector<bool> m_title_loaded;
+
 public:
   EditorLevelSelectMenu();
   EditorLevelSelectMenu(std::unique_ptr<World> world);
   ~EditorLevelSelectMenu();
 
   void menu_action(MenuItem& item) override;
+  bool load_item(MenuItem& item) override;
 
 private:
   void initialize();
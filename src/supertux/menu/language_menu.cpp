@@ -67,6 +67,7 @@ LanguageMenu::menu_action(MenuItem& item)
     FL_FreeLocale(&locale);
 
     g_dictionary_manager->set_language(language); // set currently detected language
+    invalidate_translations();
     g_config->locale = ""; // do auto detect every time on startup
     g_config->save();
     MenuManager::instance().clear_menu_stack();
@@ -75,6 +76,7 @@ LanguageMenu::menu_action(MenuItem& item)
   {
     g_config->locale = "en";
     g_dictionary_manager->set_language(tinygettext::Language::from_name(g_config->locale));
+    invalidate_translations();
     g_config->save();
     MenuManager::instance().clear_menu_stack();
   }
@@ -89,6 +91,7 @@ LanguageMenu::menu_action(MenuItem& item)
       {
         g_config->locale = lang.str();
         g_dictionary_manager->set_language(lang);
+        invalidate_translations();
         g_config->save();
         break;
       }
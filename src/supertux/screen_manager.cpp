@@ -21,6 +21,8 @@
 #include "editor/editor.hpp"
 #include "gui/menu_manager.hpp"
 #include "object/player.hpp"
+#include "squirrel/squirrel_memory.hpp"
+#include "squirrel/squirrel_scheduler.hpp"
 #include "squirrel/squirrel_virtual_machine.hpp"
 #include "supertux/console.hpp"
 #include "supertux/constants.hpp"
@@ -37,8 +39,13 @@
 #include "video/compositor.hpp"
 #include "video/drawing_context.hpp"
 
+#include <config.h>
 #include <stdio.h>
 
+#ifdef HAVE_OPENGL
+#  include "video/gl/gl_state.hpp"
+#endif
+
 /** don't skip more than every 2nd frame */
 static const int MAX_FRAME_SKIP = 2;
 
@@ -156,6 +163,54 @@ ScreenManager::draw_player_pos(DrawingContext& context)
   }
 }
 
+float
+ScreenManager::draw_script_stats(DrawingContext& context, float y)
+{
+  auto squirrel_vm = SquirrelVirtualMachine::current();
+  const auto stats = SquirrelMemory::get_stats();
+
+  std::vector<std::string> lines;
+  if (SquirrelMemory::is_enabled()) {
+    lines.push_back("Script heap: " + std::to_string(stats.heap_size / 1024) + " KiB / " +
+                    std::to_string(stats.pool_size / 1024) + " KiB pooled");
+    lines.push_back("Script allocations: " + std::to_string(stats.allocation_count));
+  }
+  lines.push_back("Script threads: " + std::to_string(SquirrelScheduler::get_total_suspended_count()) + " waiting, " +
+                  std::to_string(SquirrelScheduler::get_wakeup_count()) + " wakeups/frame");
+  if (squirrel_vm) {
+    lines.push_back("Script GC: " + std::to_string(squirrel_vm->get_gc_count()) + " runs, last " +
+                    std::to_string(static_cast<int>(squirrel_vm->get_last_gc_time() * 1000000.0f)) + " us");
+  }
+
+  for (const auto& line : lines) {
+    context.color().draw_text(Resources::small_font, line,
+                              Vector(static_cast<float>(context.get_width()) - BORDER_X, y),
+                              ALIGN_RIGHT, LAYER_HUD);
+    y += Resources::small_font->get_height() + 2.0f;
+  }
+  return y;
+}
+
+float
+ScreenManager::draw_render_stats(DrawingContext& context, float y)
+{
+#ifdef HAVE_OPENGL
+  // only the GL renderers track their calls
+  if (auto state = GLState::current())
+  {
+    const auto& stats = state->get_last_stats();
+    const std::string text = "GL calls: " + std::to_string(stats.calls) + ", " +
+      std::to_string(stats.skipped) + " skipped, " + std::to_string(stats.draws) + " draws";
+
+    context.color().draw_text(Resources::small_font, text,
+                              Vector(static_cast<float>(context.get_width()) - BORDER_X, y),
+                              ALIGN_RIGHT, LAYER_HUD);
+    y += Resources::small_font->get_height() + 2.0f;
+  }
+#endif
+  return y;
+}
+
 void
 ScreenManager::draw(Compositor& compositor)
 {
@@ -188,6 +243,15 @@ ScreenManager::draw(Compositor& compositor)
     draw_player_pos(context);
   }
 
+  float stats_y = BORDER_Y + 60.0f;
+  if (g_debug.show_script_stats) {
+    stats_y = draw_script_stats(context, stats_y);
+  }
+
+  if (g_debug.show_render_stats) {
+    stats_y = draw_render_stats(context, stats_y);
+  }
+
   // render everything
   compositor.render();
 
@@ -402,6 +466,18 @@ ScreenManager::run()
       elapsed_ticks = 0;
     }
 
+    if (auto squirrel_vm = SquirrelVirtualMachine::current())
+    {
+      // use the idle time of the frame for the script garbage collector,
+      // without idle time it only runs once it was put off for too long
+      const Uint32 idle_ticks = elapsed_ticks < ticks_per_frame ? ticks_per_frame - elapsed_ticks : 0;
+      squirrel_vm->collect_garbage(static_cast<float>(idle_ticks) / 1000.0f);
+
+      ticks = SDL_GetTicks();
+      elapsed_ticks += ticks - last_ticks;
+      last_ticks = ticks;
+    }
+
     if (elapsed_ticks < ticks_per_frame)
     {
       Uint32 delay_ticks = ticks_per_frame - elapsed_ticks;
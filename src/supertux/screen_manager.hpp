@@ -58,6 +58,9 @@ public:
 private:
   void draw_fps(DrawingContext& context, float fps);
   void draw_player_pos(DrawingContext& context);
+  /** Draw the stats starting at y and return the y of the next line */
+  float draw_script_stats(DrawingContext& context, float y);
+  float draw_render_stats(DrawingContext& context, float y);
   void draw(Compositor& compositor);
   void update_gamelogic(float dt_sec);
   void process_events();
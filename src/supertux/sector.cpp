@@ -21,6 +21,7 @@
 
 #include "audio/sound_manager.hpp"
 #include "badguy/badguy.hpp"
+#include "badguy/goldbomb.hpp"
 #include "collision/collision.hpp"
 #include "collision/collision_system.hpp"
 #include "editor/editor.hpp"
@@ -28,8 +29,10 @@
 #include "math/rect.hpp"
 #include "object/ambient_light.hpp"
 #include "object/background.hpp"
+#include "object/bonus_block.hpp"
 #include "object/bullet.hpp"
 #include "object/camera.hpp"
+#include "object/coin.hpp"
 #include "object/display_effect.hpp"
 #include "object/gradient.hpp"
 #include "object/music_object.hpp"
@@ -52,6 +55,9 @@
 #include "supertux/player_status_hud.hpp"
 #include "supertux/savegame.hpp"
 #include "supertux/tile.hpp"
+#include "supertux/tile_set.hpp"
+#include "supertux/tile_storage.hpp"
+#include "trigger/secretarea_trigger.hpp"
 #include "util/file_system.hpp"
 #include "util/writer.hpp"
 #include "video/video_system.hpp"
@@ -63,6 +69,84 @@ namespace {
 
 PlayerStatus dummy_player_status;
 
+/** Lava blocks are lit by a single light as long as they are at most
+    this many tiles wide and high, the light gets too dim at the edges
+    of larger blocks */
+const int MAX_LAVA_LIGHT_TILES = 6;
+
+/** Block of lava tiles with the same attributes, (x1, y1) is the
+    first tile, (x2, y2) is one past the last */
+struct LavaArea
+{
+  int x1;
+  int y1;
+  int x2;
+  int y2;
+  uint32_t attributes;
+};
+
+/** Appends tile (x, y) to the last run of lava_runs or starts a new
+    one, tiles have to be added in row-major order */
+void add_lava_tile(std::vector<LavaArea>& lava_runs, int x, int y, uint32_t attributes)
+{
+  if (!lava_runs.empty())
+  {
+    LavaArea& run = lava_runs.back();
+    if (run.y1 == y && run.x2 == x && run.attributes == attributes &&
+        run.x2 - run.x1 < MAX_LAVA_LIGHT_TILES)
+    {
+      run.x2 += 1;
+      return;
+    }
+  }
+
+  lava_runs.push_back({x, y, x + 1, y + 1, attributes});
+}
+
+/** Stacks runs that cover the same columns in consecutive rows into
+    blocks */
+std::vector<LavaArea> merge_lava_runs(const std::vector<LavaArea>& lava_runs)
+{
+  std::vector<LavaArea> areas;
+  std::vector<size_t> prev_row;
+  std::vector<size_t> row;
+  int row_y = -1;
+
+  for (const auto& run : lava_runs)
+  {
+    if (run.y1 != row_y)
+    {
+      if (row_y + 1 == run.y1) {
+        prev_row.swap(row);
+      } else {
+        prev_row.clear();
+      }
+      row.clear();
+      row_y = run.y1;
+    }
+
+    auto it = std::find_if(prev_row.begin(), prev_row.end(),
+                           [&areas, &run](size_t idx) {
+                             const LavaArea& area = areas[idx];
+                             return area.x1 == run.x1 && area.x2 == run.x2 &&
+                               area.attributes == run.attributes &&
+                               area.y2 - area.y1 < MAX_LAVA_LIGHT_TILES;
+                           });
+    if (it != prev_row.end())
+    {
+      areas[*it].y2 = run.y2;
+      row.push_back(*it);
+    }
+    else
+    {
+      row.push_back(areas.size());
+      areas.push_back(run);
+    }
+  }
+
+  return areas;
+}
+
 } // namespace
 
 Sector::Sector(Level& parent) :
@@ -73,7 +157,8 @@ Sector::Sector(Level& parent) :
   m_foremost_layer(),
   m_squirrel_environment(new SquirrelEnvironment(SquirrelVirtualMachine::current()->get_vm(), "sector")),
   m_collision_system(new CollisionSystem(*this)),
-  m_gravity(10.0)
+  m_gravity(10.0),
+  m_statistics_totals()
 {
   Savegame* savegame = (Editor::current() && Editor::is_active()) ?
     Editor::current()->m_savegame.get() :
@@ -102,6 +187,8 @@ Sector::~Sector()
     log_warning << err.what() << std::endl;
   }
 
+  // objects removed from here on leave the level
+  m_fully_constructed = false;
   clear_objects();
 }
 
@@ -196,10 +283,7 @@ Sector::activate(const Vector& player_pos)
     s_current = this;
 
     m_squirrel_environment->expose_self();
-
-    for (auto& object : get_objects()) {
-      m_squirrel_environment->try_expose(*object);
-    }
+    m_squirrel_environment->try_expose(get_objects());
   }
 
   // The Sector object is called 'settings' as it is accessed as 'sector.settings'
@@ -264,10 +348,7 @@ Sector::deactivate()
     return;
 
   m_squirrel_environment->unexpose_self();
-
-  for (const auto& object: get_objects()) {
-    m_squirrel_environment->try_unexpose(*object);
-  }
+  m_squirrel_environment->try_unexpose(get_objects());
 
   m_squirrel_environment->unexpose("settings");
 
@@ -357,6 +438,8 @@ Sector::before_object_add(GameObject& object)
     object.finish_construction();
   }
 
+  add_statistics_contribution(object);
+
   return true;
 }
 
@@ -370,6 +453,46 @@ Sector::before_object_remove(GameObject& object)
 
   if (s_current == this)
     m_squirrel_environment->try_unexpose(object);
+
+  m_statistics_totals.remove(object, is_changing_level());
+}
+
+bool
+Sector::is_changing_level() const
+{
+  return !m_fully_constructed || Editor::is_active();
+}
+
+void
+Sector::add_statistics_contribution(const GameObject& object)
+{
+  // coins or badguys spawned while playing are not part of the totals
+  if (!is_changing_level())
+    return;
+
+  StatisticsTotals::Contribution contribution = { 0, 0, 0 };
+
+  if (dynamic_cast<const Coin*>(&object)) {
+    contribution.coins = 1;
+  } else if (auto block = dynamic_cast<const BonusBlock*>(&object)) {
+    if (block->get_contents() == BonusBlock::Content::COIN) {
+      contribution.coins = block->get_hit_counter();
+    } else if (block->get_contents() == BonusBlock::Content::RAIN ||
+               block->get_contents() == BonusBlock::Content::EXPLODE) {
+      contribution.coins = 10;
+    }
+  } else if (auto badguy = dynamic_cast<const BadGuy*>(&object)) {
+    if (dynamic_cast<const GoldBomb*>(badguy)) {
+      contribution.coins = 10;
+    }
+    if (badguy->m_countMe) {
+      contribution.badguys = 1;
+    }
+  } else if (dynamic_cast<const SecretAreaTrigger*>(&object)) {
+    contribution.secrets = 1;
+  }
+
+  m_statistics_totals.add(object, contribution);
 }
 
 void
@@ -609,59 +732,82 @@ Sector::save(Writer &writer)
 void
 Sector::convert_tiles2gameobject()
 {
-  // add lights for special tiles
   for (auto& tm : get_objects_by_type<TileMap>())
   {
-    for (int x=0; x < tm.get_width(); ++x)
+    const TileSet* tileset = tm.get_tileset();
+    if (!tileset)
+      continue;
+
+    const TileStorage& tiles = tm.get_tile_storage();
+    std::vector<LavaArea> lava_runs;
+
+    for (int cy = 0; cy < tiles.get_chunks_height(); ++cy)
     {
-      for (int y=0; y < tm.get_height(); ++y)
+      const int y_end = std::min((cy + 1) * TileStorage::CHUNK_SIZE, tm.get_height());
+      for (int y = cy * TileStorage::CHUNK_SIZE; y < y_end; ++y)
       {
-        const Tile& tile = tm.get_tile(x, y);
-
-        if (!tile.get_object_name().empty())
+        for (int cx = 0; cx < tiles.get_chunks_width(); ++cx)
         {
-          // If a tile is associated with an object, insert that
-          // object and remove the tile
-          if (tile.get_object_name() == "decal" ||
-              tm.is_solid())
+          // most chunks of a level are empty or hold plain tiles only
+          if (tiles.is_chunk_empty(cx, cy))
+            continue;
+
+          const int x_end = std::min((cx + 1) * TileStorage::CHUNK_SIZE, tm.get_width());
+          for (int x = cx * TileStorage::CHUNK_SIZE; x < x_end; ++x)
           {
-            Vector pos = tm.get_tile_position(x, y);
-            try {
-              auto object = GameObjectFactory::instance().create(tile.get_object_name(), pos, Direction::AUTO, tile.get_object_data());
-              add_object(std::move(object));
-              tm.change(x, y, 0);
-            } catch(std::exception& e) {
-              log_warning << e.what() << "" << std::endl;
-            }
-          }
-        }
-        else
-        {
-          // add lights for fire tiles
-          uint32_t attributes = tile.get_attributes();
-          Vector pos = tm.get_tile_position(x, y);
-          Vector center = pos + Vector(16, 16);
-
-          if (attributes & Tile::FIRE) {
-            if (attributes & Tile::HURTS) {
-              // lava or lavaflow
-              // space lights a bit
-              if ((tm.get_tile(x-1, y).get_attributes() != attributes || x%3 == 0)
-                  && (tm.get_tile(x, y-1).get_attributes() != attributes || y%3 == 0)) {
+            const uint32_t id = tiles.get(x, y);
+            const TileSet::Conversion conversion = tileset->get_conversion(id);
+            switch (conversion)
+            {
+              case TileSet::CONVERT_NONE:
+                break;
+
+              case TileSet::CONVERT_OBJECT:
+              case TileSet::CONVERT_DECAL:
+                // If a tile is associated with an object, insert that
+                // object and remove the tile
+                if (conversion == TileSet::CONVERT_DECAL || tm.is_solid())
+                {
+                  const Tile& tile = tileset->get(id);
+                  try {
+                    auto object = GameObjectFactory::instance().create(tile.get_object_name(), tm.get_tile_position(x, y),
+                                                                       Direction::AUTO, tile.get_object_data());
+                    add_object(std::move(object));
+                    tm.change(x, y, 0);
+                  } catch(std::exception& e) {
+                    log_warning << e.what() << "" << std::endl;
+                  }
+                }
+                break;
+
+              case TileSet::CONVERT_LAVA_LIGHT:
+                add_lava_tile(lava_runs, x, y, tileset->get(id).get_attributes());
+                break;
+
+              case TileSet::CONVERT_TORCH_LIGHT:
+              {
+                Vector pos = tm.get_tile_position(x, y);
                 float pseudo_rnd = static_cast<float>(static_cast<int>(pos.x) % 10) / 10;
-                add<PulsingLight>(center, 1.0f + pseudo_rnd, 0.8f, 1.0f,
-                                  Color(1.0f, 0.3f, 0.0f, 1.0f));
+                add<PulsingLight>(pos + Vector(16, 16), 1.0f + pseudo_rnd, 0.9f, 1.0f,
+                                  Color(1.0f, 1.0f, 0.6f, 1.0f));
+                break;
               }
-            } else {
-              // torch
-              float pseudo_rnd = static_cast<float>(static_cast<int>(pos.x) % 10) / 10;
-              add<PulsingLight>(center, 1.0f + pseudo_rnd, 0.9f, 1.0f,
-                                Color(1.0f, 1.0f, 0.6f, 1.0f));
             }
           }
         }
       }
     }
+
+    // one light per block of lava, instead of one every three tiles
+    for (const auto& area : merge_lava_runs(lava_runs))
+    {
+      const Vector p1 = tm.get_tile_position(area.x1, area.y1);
+      const Vector p2 = tm.get_tile_position(area.x2, area.y2);
+      float pseudo_rnd = static_cast<float>(static_cast<int>(p1.x) % 10) / 10;
+      auto& light = add<PulsingLight>((p1 + p2) / 2.0f, 1.0f + pseudo_rnd, 0.8f, 1.0f,
+                                      Color(1.0f, 0.3f, 0.0f, 1.0f));
+      light.set_area(Sizef(p2.x - p1.x - 32.0f, p2.y - p1.y - 32.0f));
+    }
   }
 }
 
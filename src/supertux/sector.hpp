@@ -24,6 +24,7 @@
 #include "squirrel/squirrel_environment.hpp"
 #include "supertux/d_scope.hpp"
 #include "supertux/game_object_manager.hpp"
+#include "supertux/statistics_totals.hpp"
 #include "video/color.hpp"
 
 namespace collision {
@@ -147,9 +148,24 @@ public:
   Player& get_player() const;
   DisplayEffect& get_effect() const;
 
+  /** Statistics totals of this sector, they are kept up to date as
+      objects are added to or removed from the level, so querying them
+      is cheap. Collecting a coin or killing a badguy doesn't change
+      them. */
+  int get_total_coins() const { return m_statistics_totals.get_coins(); }
+  int get_total_badguys() const { return m_statistics_totals.get_badguys(); }
+  int get_total_secrets() const { return m_statistics_totals.get_secrets(); }
+
 private:
   uint32_t collision_tile_attributes(const Rectf& dest, const Vector& mov) const;
 
+  /** True while added or removed objects change the level itself,
+      i.e. while the sector is built or torn down and in the editor,
+      as opposed to objects spawned or destroyed while playing */
+  bool is_changing_level() const;
+
+  void add_statistics_contribution(const GameObject& object);
+
   virtual bool before_object_add(GameObject& object) override;
   virtual void before_object_remove(GameObject& object) override;
 
@@ -176,6 +192,8 @@ private:
 
   float m_gravity;
 
+  StatisticsTotals m_statistics_totals;
+
 private:
   Sector(const Sector&) = delete;
   Sector& operator=(const Sector&) = delete;
@@ -43,12 +43,13 @@ Statistics::Statistics() :
   m_badguys(),
   m_secrets(),
   m_time(),
+  m_level_checksum(),
   m_max_width(256),
-  CAPTION_MAX_COINS(_("Max coins collected:")),
-  CAPTION_MAX_FRAGGING(_("Max fragging:")),
-  CAPTION_MAX_SECRETS(_("Max secrets found:")),
-  CAPTION_BEST_TIME(_("Best time completed:")),
-  CAPTION_TARGET_TIME(_("Level target time:")),
+  CAPTION_MAX_COINS(TranslatedString("Max coins collected:")),
+  CAPTION_MAX_FRAGGING(TranslatedString("Max fragging:")),
+  CAPTION_MAX_SECRETS(TranslatedString("Max secrets found:")),
+  CAPTION_BEST_TIME(TranslatedString("Best time completed:")),
+  CAPTION_TARGET_TIME(TranslatedString("Level target time:")),
   WMAP_INFO_LEFT_X(),
   WMAP_INFO_RIGHT_X(),
   WMAP_INFO_TOP_Y1(),
@@ -64,8 +65,8 @@ Statistics::Statistics() :
 void
 Statistics::calculate_max_caption_length()
 {
-  auto captions = {CAPTION_MAX_COINS, CAPTION_MAX_FRAGGING, CAPTION_MAX_SECRETS,
-                   CAPTION_BEST_TIME, CAPTION_TARGET_TIME};
+  auto captions = {&CAPTION_MAX_COINS, &CAPTION_MAX_FRAGGING, &CAPTION_MAX_SECRETS,
+                   &CAPTION_BEST_TIME, &CAPTION_TARGET_TIME};
 
   m_max_width = 256;
 
@@ -73,7 +74,7 @@ Statistics::calculate_max_caption_length()
   {
     auto font = Resources::small_font;
     // Add padding the size of lengthiest string:
-    auto width = font->get_text_width(caption) +
+    auto width = font->get_text_width(*caption) +
                  font->get_text_width("XX:XX:XX");
     if (width >= static_cast<float>(m_max_width))
     {
@@ -95,6 +96,9 @@ Statistics::serialize_to_squirrel(SquirrelVM& vm) const
   vm.store_int("coins-collected-total", m_total_coins);
   vm.store_int("badguys-killed-total", m_total_badguys);
   vm.store_int("secrets-found-total", m_total_secrets);
+  if (!m_level_checksum.empty()) {
+    vm.store_string("level-checksum", m_level_checksum);
+  }
   vm.end_table("statistics");
 }
 
@@ -111,6 +115,7 @@ Statistics::unserialize_from_squirrel(SquirrelVM& vm)
     vm.get_int("coins-collected-total", m_total_coins);
     vm.get_int("badguys-killed-total", m_total_badguys);
     vm.get_int("secrets-found-total", m_total_secrets);
+    vm.get_string("level-checksum", m_level_checksum);
     sq_pop(vm.get_vm(), 1);
 
     m_status = FINAL;
@@ -135,12 +140,16 @@ Statistics::draw_worldmap_info(DrawingContext& context, float target_time)
     WMAP_INFO_TOP_Y2 = WMAP_INFO_TOP_Y1 + 16;
   }
 
+  static const TranslatedString s_best_level_statistics = TranslatedString("Best Level Statistics");
+
   context.color().draw_text(
-    Resources::small_font, std::string("- ") + _("Best Level Statistics") + " -",
+    Resources::small_font, "- " + s_best_level_statistics.get() + " -",
     Vector((WMAP_INFO_LEFT_X + WMAP_INFO_RIGHT_X) / 2, WMAP_INFO_TOP_Y1),
     ALIGN_CENTER, LAYER_HUD,Statistics::header_color);
 
-  std::string caption_buf;
+  static const std::string s_empty;
+
+  const std::string* caption_buf;
   std::string stat_buf;
   float posy = WMAP_INFO_TOP_Y2;
 
@@ -148,36 +157,37 @@ Statistics::draw_worldmap_info(DrawingContext& context, float target_time)
     switch (stat_no)
     {
       case 0:
-        caption_buf = CAPTION_MAX_COINS;
+        caption_buf = &CAPTION_MAX_COINS.get();
         stat_buf = coins_to_string(m_coins, m_total_coins);
         break;
       case 1:
-        caption_buf = CAPTION_MAX_FRAGGING;
+        caption_buf = &CAPTION_MAX_FRAGGING.get();
         stat_buf = frags_to_string(m_badguys, m_total_badguys);
         break;
       case 2:
-        caption_buf = CAPTION_MAX_SECRETS;
+        caption_buf = &CAPTION_MAX_SECRETS.get();
         stat_buf = secrets_to_string(m_secrets, m_total_secrets);
         break;
       case 3:
-        caption_buf = CAPTION_BEST_TIME;
+        caption_buf = &CAPTION_BEST_TIME.get();
         stat_buf = time_to_string(m_time);
         break;
       case 4:
         if (target_time != 0.0f) { // display target time only if defined for level
-          caption_buf = CAPTION_TARGET_TIME;
+          caption_buf = &CAPTION_TARGET_TIME.get();
           stat_buf = time_to_string(target_time);
         } else {
-          caption_buf = "";
+          caption_buf = &s_empty;
           stat_buf = "";
         }
         break;
       default:
         log_debug << "Invalid stat requested to be drawn" << std::endl;
+        caption_buf = &s_empty;
         break;
     }
 
-    context.color().draw_text(Resources::small_font, caption_buf, Vector(WMAP_INFO_LEFT_X, posy), ALIGN_LEFT, LAYER_HUD, Statistics::header_color);
+    context.color().draw_text(Resources::small_font, *caption_buf, Vector(WMAP_INFO_LEFT_X, posy), ALIGN_LEFT, LAYER_HUD, Statistics::header_color);
     context.color().draw_text(Resources::small_font, stat_buf, Vector(WMAP_INFO_RIGHT_X, posy), ALIGN_RIGHT, LAYER_HUD, Statistics::header_color);
     posy += Resources::small_font->get_height() + 2;
   }
@@ -213,11 +223,18 @@ Statistics::draw_endseq_panel(DrawingContext& context, Statistics* best_stats, c
   context.color().draw_surface(backdrop, Vector(static_cast<float>(bd_x), static_cast<float>(bd_y)), LAYER_HUD);
   context.pop_transform();
 
-  context.color().draw_text(Resources::normal_font, _("You"), Vector(col2_x, row1_y), ALIGN_LEFT, LAYER_HUD, Statistics::header_color);
+  static const TranslatedString s_you = TranslatedString("You");
+  static const TranslatedString s_best = TranslatedString("Best");
+  static const TranslatedString s_coins = TranslatedString("Coins");
+  static const TranslatedString s_badguys = TranslatedString("Badguys");
+  static const TranslatedString s_secrets = TranslatedString("Secrets");
+  static const TranslatedString s_time = TranslatedString("Time");
+
+  context.color().draw_text(Resources::normal_font, s_you, Vector(col2_x, row1_y), ALIGN_LEFT, LAYER_HUD, Statistics::header_color);
   if (best_stats)
-    context.color().draw_text(Resources::normal_font, _("Best"), Vector(col3_x, row1_y), ALIGN_LEFT, LAYER_HUD, Statistics::header_color);
+    context.color().draw_text(Resources::normal_font, s_best, Vector(col3_x, row1_y), ALIGN_LEFT, LAYER_HUD, Statistics::header_color);
 
-  context.color().draw_text(Resources::normal_font, _("Coins"), Vector(col2_x - 16.0f, static_cast<float>(row3_y)), ALIGN_RIGHT, LAYER_HUD, Statistics::header_color);
+  context.color().draw_text(Resources::normal_font, s_coins, Vector(col2_x - 16.0f, static_cast<float>(row3_y)), ALIGN_RIGHT, LAYER_HUD, Statistics::header_color);
   context.color().draw_text(Resources::normal_font, coins_to_string(m_coins, m_total_coins), Vector(col2_x, static_cast<float>(row3_y)), ALIGN_LEFT, LAYER_HUD, Statistics::text_color);
 
   if (best_stats) {
@@ -226,7 +243,7 @@ Statistics::draw_endseq_panel(DrawingContext& context, Statistics* best_stats, c
     context.color().draw_text(Resources::normal_font, coins_to_string(coins_best, total_coins_best), Vector(col3_x, static_cast<float>(row3_y)), ALIGN_LEFT, LAYER_HUD, Statistics::text_color);
   }
 
-  context.color().draw_text(Resources::normal_font, _("Badguys"), Vector(col2_x - 16.0f, static_cast<float>(row4_y)), ALIGN_RIGHT, LAYER_HUD, Statistics::header_color);
+  context.color().draw_text(Resources::normal_font, s_badguys, Vector(col2_x - 16.0f, static_cast<float>(row4_y)), ALIGN_RIGHT, LAYER_HUD, Statistics::header_color);
   context.color().draw_text(Resources::normal_font, frags_to_string(m_badguys, m_total_badguys), Vector(col2_x, static_cast<float>(row4_y)), ALIGN_LEFT, LAYER_HUD, Statistics::text_color);
   if (best_stats) {
 	int badguys_best = (best_stats->m_badguys > m_badguys) ? best_stats->m_badguys : m_badguys;
@@ -234,7 +251,7 @@ Statistics::draw_endseq_panel(DrawingContext& context, Statistics* best_stats, c
 	context.color().draw_text(Resources::normal_font, frags_to_string(badguys_best, total_badguys_best), Vector(col3_x, row4_y), ALIGN_LEFT, LAYER_HUD, Statistics::text_color);
   }
 
-  context.color().draw_text(Resources::normal_font, _("Secrets"), Vector(col2_x-16, row5_y), ALIGN_RIGHT, LAYER_HUD, Statistics::header_color);
+  context.color().draw_text(Resources::normal_font, s_secrets, Vector(col2_x-16, row5_y), ALIGN_RIGHT, LAYER_HUD, Statistics::header_color);
   context.color().draw_text(Resources::normal_font, secrets_to_string(m_secrets, m_total_secrets), Vector(col2_x, row5_y), ALIGN_LEFT, LAYER_HUD, Statistics::text_color);
   if (best_stats) {
     int secrets_best = (best_stats->m_secrets > m_secrets) ? best_stats->m_secrets : m_secrets;
@@ -242,7 +259,7 @@ Statistics::draw_endseq_panel(DrawingContext& context, Statistics* best_stats, c
     context.color().draw_text(Resources::normal_font, secrets_to_string(secrets_best, total_secrets_best), Vector(col3_x, row5_y), ALIGN_LEFT, LAYER_HUD, Statistics::text_color);
   }
 
-  context.color().draw_text(Resources::normal_font, _("Time"), Vector(col2_x - 16, row2_y), ALIGN_RIGHT, LAYER_HUD, Statistics::header_color);
+  context.color().draw_text(Resources::normal_font, s_time, Vector(col2_x - 16, row2_y), ALIGN_RIGHT, LAYER_HUD, Statistics::header_color);
   context.color().draw_text(Resources::normal_font, time_to_string(m_time), Vector(col2_x, row2_y), ALIGN_LEFT, LAYER_HUD, Statistics::text_color);
   if (best_stats) {
     float time_best = (best_stats->m_time < m_time && best_stats->m_time > 0.0f) ? best_stats->m_time : m_time;
@@ -262,6 +279,24 @@ Statistics::init(const Level& level)
   m_total_coins = level.get_total_coins();
   m_total_badguys = level.get_total_badguys();
   m_total_secrets = level.get_total_secrets();
+
+  m_level_checksum = level.m_checksum;
+}
+
+void
+Statistics::init(const Statistics& recorded)
+{
+  m_status = ACCUMULATING;
+
+  m_coins = 0;
+  m_badguys = 0;
+  m_secrets = 0;
+
+  m_total_coins = recorded.m_total_coins;
+  m_total_badguys = recorded.m_total_badguys;
+  m_total_secrets = recorded.m_total_secrets;
+
+  m_level_checksum = recorded.m_level_checksum;
 }
 
 void
@@ -293,6 +328,7 @@ Statistics::update(const Statistics& other)
   m_total_coins = other.m_total_coins;
   m_total_badguys = other.m_total_badguys;
   m_total_secrets = other.m_total_secrets;
+  m_level_checksum = other.m_level_checksum;
 
   m_coins = math::clamp(m_coins, 0, m_total_coins);
   m_badguys = math::clamp(m_badguys, 0, m_total_badguys);
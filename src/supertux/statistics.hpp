@@ -19,6 +19,7 @@
 #ifndef HEADER_SUPERTUX_SUPERTUX_STATISTICS_HPP
 #define HEADER_SUPERTUX_SUPERTUX_STATISTICS_HPP
 
+#include "util/translated_string.hpp"
 #include "video/color.hpp"
 #include "video/surface_ptr.hpp"
 
@@ -57,11 +58,20 @@ public:
   void draw_endseq_panel(DrawingContext& context, Statistics* best_stats, const SurfacePtr& backdrop); /**< draw panel shown during level's end sequence */
 
   void init(const Level& level);
+
+  /** Like init(), but takes the totals from previously recorded
+      statistics instead of counting them in the level. Only valid if
+      get_level_checksum() of both matches, i.e. the level file didn't
+      change since the statistics were recorded. */
+  void init(const Statistics& recorded);
   void finish(float time);
   void invalidate();
 
   Status get_status() const { return m_status; }
 
+  /** MD5 of the level file the totals were counted in */
+  const std::string& get_level_checksum() const { return m_level_checksum; }
+
 public:
   void update(const Statistics& stats); /**< Given another Statistics object finds the best of each one */
   bool completed(const Statistics& stats, const float target_time) const; /* Check if stats match total stats */
@@ -85,16 +95,17 @@ public:
 
 private:
   float m_time; /**< seconds needed */
+  std::string m_level_checksum;
 
 private:
   int m_max_width; /** < Gets the max width of a stats line, 255 by default */
 
   /** Captions */
-  std::string CAPTION_MAX_COINS;
-  std::string CAPTION_MAX_FRAGGING;
-  std::string CAPTION_MAX_SECRETS;
-  std::string CAPTION_BEST_TIME;
-  std::string CAPTION_TARGET_TIME;
+  TranslatedString CAPTION_MAX_COINS;
+  TranslatedString CAPTION_MAX_FRAGGING;
+  TranslatedString CAPTION_MAX_SECRETS;
+  TranslatedString CAPTION_BEST_TIME;
+  TranslatedString CAPTION_TARGET_TIME;
 
   float WMAP_INFO_LEFT_X;
   float WMAP_INFO_RIGHT_X;
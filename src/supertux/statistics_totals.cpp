@@ -0,0 +1,57 @@
+//  SuperTux
+//  Copyright (C) 2020 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "supertux/statistics_totals.hpp"
+
+StatisticsTotals::StatisticsTotals() :
+  m_contributions(),
+  m_coins(0),
+  m_badguys(0),
+  m_secrets(0)
+{
+}
+
+void
+StatisticsTotals::add(const GameObject& object, const Contribution& contribution)
+{
+  if (contribution.coins == 0 && contribution.badguys == 0 && contribution.secrets == 0)
+    return;
+
+  m_coins += contribution.coins;
+  m_badguys += contribution.badguys;
+  m_secrets += contribution.secrets;
+  m_contributions[&object] = contribution;
+}
+
+void
+StatisticsTotals::remove(const GameObject& object, bool from_level)
+{
+  auto it = m_contributions.find(&object);
+  if (it == m_contributions.end())
+    return;
+
+  if (from_level)
+  {
+    m_coins -= it->second.coins;
+    m_badguys -= it->second.badguys;
+    m_secrets -= it->second.secrets;
+  }
+
+  // the address may be reused by a later object
+  m_contributions.erase(it);
+}
+
+/* EOF */
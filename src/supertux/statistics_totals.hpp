@@ -0,0 +1,68 @@
+//  SuperTux
+//  Copyright (C) 2020 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef HEADER_SUPERTUX_SUPERTUX_STATISTICS_TOTALS_HPP
+#define HEADER_SUPERTUX_SUPERTUX_STATISTICS_TOTALS_HPP
+
+#include <unordered_map>
+
+class GameObject;
+
+/** Coins, badguys and secrets that the objects of a sector make
+    available. The totals describe the level as it was defined, so
+    they don't change when a coin is collected or a badguy killed. */
+class StatisticsTotals final
+{
+public:
+  /** What a single object adds to the totals */
+  struct Contribution
+  {
+    int coins;
+    int badguys;
+    int secrets;
+  };
+
+public:
+  StatisticsTotals();
+
+  void add(const GameObject& object, const Contribution& contribution);
+
+  /** Forgets about 'object'. Its contribution is only subtracted if
+      'from_level' is set, i.e. when the object is deleted in the
+      editor or the sector is torn down, not when it is removed while
+      playing. */
+  void remove(const GameObject& object, bool from_level);
+
+  int get_coins() const { return m_coins; }
+  int get_badguys() const { return m_badguys; }
+  int get_secrets() const { return m_secrets; }
+
+private:
+  /** Contributions are remembered as they were on insertion, as for
+      example a BonusBlock's hit counter changes while playing */
+  std::unordered_map<const GameObject*, Contribution> m_contributions;
+  int m_coins;
+  int m_badguys;
+  int m_secrets;
+
+private:
+  StatisticsTotals(const StatisticsTotals&) = delete;
+  StatisticsTotals& operator=(const StatisticsTotals&) = delete;
+};
+
+#endif
+
+/* EOF */
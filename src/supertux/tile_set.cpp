@@ -47,6 +47,7 @@ TileSet::from_file(const std::string& filename)
 
 TileSet::TileSet() :
   m_tiles(1),
+  m_conversions(1, CONVERT_NONE),
   m_tilegroups()
 {
   m_tiles[0] = std::make_unique<Tile>();
@@ -57,15 +58,32 @@ TileSet::add_tile(int id, std::unique_ptr<Tile> tile)
 {
   if (id >= static_cast<int>(m_tiles.size())) {
     m_tiles.resize(id + 1);
+    m_conversions.resize(id + 1, CONVERT_NONE);
   }
 
   if (m_tiles[id]) {
     log_warning << "Tile with ID " << id << " redefined" << std::endl;
   } else {
+    m_conversions[id] = get_conversion(*tile);
     m_tiles[id] = std::move(tile);
   }
 }
 
+TileSet::Conversion
+TileSet::get_conversion(const Tile& tile)
+{
+  if (!tile.get_object_name().empty()) {
+    return tile.get_object_name() == "decal" ? CONVERT_DECAL : CONVERT_OBJECT;
+  }
+
+  const uint32_t attributes = tile.get_attributes();
+  if (attributes & Tile::FIRE) {
+    return (attributes & Tile::HURTS) ? CONVERT_LAVA_LIGHT : CONVERT_TORCH_LIGHT;
+  }
+
+  return CONVERT_NONE;
+}
+
 const Tile&
 TileSet::get(const uint32_t id) const
 {
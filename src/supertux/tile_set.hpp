@@ -20,6 +20,7 @@
 #include <memory>
 #include <stdint.h>
 #include <string>
+#include <vector>
 
 #include "video/color.hpp"
 #include "video/surface_ptr.hpp"
@@ -41,6 +42,19 @@ public:
 
 class TileSet final
 {
+public:
+  /** What Sector::convert_tiles2gameobject() does with a tile, kept
+      per id so tilemaps can be scanned without looking at the tiles */
+  enum Conversion : uint8_t {
+    CONVERT_NONE,
+    /** Replaced by its object on solid tilemaps */
+    CONVERT_OBJECT,
+    /** Replaced by its object on any tilemap */
+    CONVERT_DECAL,
+    CONVERT_LAVA_LIGHT,
+    CONVERT_TORCH_LIGHT
+  };
+
 public:
   static std::unique_ptr<TileSet> from_file(const std::string& filename);
 
@@ -57,6 +71,10 @@ public:
 
   const Tile& get(const uint32_t id) const;
 
+  Conversion get_conversion(uint32_t id) const {
+    return id < m_conversions.size() ? m_conversions[id] : CONVERT_NONE;
+  }
+
   uint32_t get_max_tileid() const {
     return static_cast<uint32_t>(m_tiles.size());
   }
@@ -67,8 +85,12 @@ public:
 
   void print_debug_info(const std::string& filename);
 
+private:
+  static Conversion get_conversion(const Tile& tile);
+
 private:
   std::vector<std::unique_ptr<Tile> > m_tiles;
+  std::vector<Conversion> m_conversions;
   std::vector<Tilegroup> m_tilegroups;
 
 private:
@@ -0,0 +1,145 @@
+//  SuperTux
+//  Copyright (C) 2020 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "supertux/tile_storage.hpp"
+
+#include <stdexcept>
+
+TileStorage::Chunk::Chunk() :
+  m_ids(CHUNK_SIZE * CHUNK_SIZE, 0),
+  m_wide_ids(),
+  m_used(0)
+{
+}
+
+void
+TileStorage::Chunk::set(int idx, uint32_t id)
+{
+  const uint32_t old_id = get(idx);
+  if (old_id == id)
+    return;
+
+  if (old_id == 0) {
+    m_used += 1;
+  } else if (id == 0) {
+    m_used -= 1;
+  }
+
+  if (m_wide_ids.empty() && id > 0xFFFF) {
+    m_wide_ids.assign(m_ids.begin(), m_ids.end());
+    m_ids.clear();
+    m_ids.shrink_to_fit();
+  }
+
+  if (m_wide_ids.empty()) {
+    m_ids[idx] = static_cast<uint16_t>(id);
+  } else {
+    m_wide_ids[idx] = id;
+  }
+}
+
+size_t
+TileStorage::Chunk::get_memory_usage() const
+{
+  return sizeof(Chunk) +
+    m_ids.capacity() * sizeof(uint16_t) +
+    m_wide_ids.capacity() * sizeof(uint32_t);
+}
+
+TileStorage::TileStorage() :
+  m_width(0),
+  m_height(0),
+  m_chunks_width(0),
+  m_chunks_height(0),
+  m_chunks()
+{
+}
+
+void
+TileStorage::reset(int width, int height)
+{
+  if (width < 0 || height < 0)
+    throw std::runtime_error("Invalid tilemap size.");
+
+  m_width = width;
+  m_height = height;
+  m_chunks_width = (width + CHUNK_SIZE - 1) / CHUNK_SIZE;
+  m_chunks_height = (height + CHUNK_SIZE - 1) / CHUNK_SIZE;
+
+  m_chunks.clear();
+  m_chunks.resize(m_chunks_width * m_chunks_height);
+}
+
+void
+TileStorage::assign(int width, int height, const std::vector<uint32_t>& tiles)
+{
+  if (static_cast<int>(tiles.size()) != width * height)
+    throw std::runtime_error("Wrong tile count.");
+
+  reset(width, height);
+
+  for (int y = 0; y < height; ++y) {
+    for (int x = 0; x < width; ++x) {
+      set(x, y, tiles[y * width + x]);
+    }
+  }
+}
+
+void
+TileStorage::set(int x, int y, uint32_t id)
+{
+  assert(x >= 0 && x < m_width && y >= 0 && y < m_height);
+
+  auto& chunk = m_chunks[(y >> CHUNK_SHIFT) * m_chunks_width + (x >> CHUNK_SHIFT)];
+  if (!chunk) {
+    if (id == 0)
+      return;
+
+    chunk = std::make_unique<Chunk>();
+  }
+
+  chunk->set(((y & CHUNK_MASK) << CHUNK_SHIFT) + (x & CHUNK_MASK), id);
+
+  if (chunk->empty()) {
+    chunk.reset();
+  }
+}
+
+std::vector<uint32_t>
+TileStorage::to_vector() const
+{
+  std::vector<uint32_t> result(m_width * m_height);
+  for (int y = 0; y < m_height; ++y) {
+    for (int x = 0; x < m_width; ++x) {
+      result[y * m_width + x] = get(x, y);
+    }
+  }
+  return result;
+}
+
+size_t
+TileStorage::get_memory_usage() const
+{
+  size_t result = m_chunks.capacity() * sizeof(std::unique_ptr<Chunk>);
+  for (const auto& chunk : m_chunks) {
+    if (chunk) {
+      result += chunk->get_memory_usage();
+    }
+  }
+  return result;
+}
+
+/* EOF */
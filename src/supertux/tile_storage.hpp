@@ -0,0 +1,114 @@
+//  SuperTux
+//  Copyright (C) 2020 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef HEADER_SUPERTUX_SUPERTUX_TILE_STORAGE_HPP
+#define HEADER_SUPERTUX_SUPERTUX_TILE_STORAGE_HPP
+
+#include <assert.h>
+#include <memory>
+#include <stdint.h>
+#include <vector>
+
+/** Stores the tile ids of a TileMap in square chunks. Chunks that
+    only contain empty tiles are not allocated at all and a chunk only
+    switches from 16-bit to 32-bit ids once a tile in it needs it, as
+    most background and foreground layers are sparse and use small
+    ids. */
+class TileStorage final
+{
+public:
+  /** Width and height of a chunk in tiles, must be a power of two */
+  static const int CHUNK_SIZE = 16;
+
+private:
+  static const int CHUNK_SHIFT = 4;
+  static const int CHUNK_MASK = CHUNK_SIZE - 1;
+
+  class Chunk final
+  {
+  public:
+    Chunk();
+
+    uint32_t get(int idx) const {
+      return m_wide_ids.empty() ? m_ids[idx] : m_wide_ids[idx];
+    }
+
+    void set(int idx, uint32_t id);
+
+    bool empty() const { return m_used == 0; }
+    size_t get_memory_usage() const;
+
+  private:
+    std::vector<uint16_t> m_ids;
+    std::vector<uint32_t> m_wide_ids;
+
+    /** Number of non-empty tiles in this chunk */
+    int m_used;
+
+  private:
+    Chunk(const Chunk&) = delete;
+    Chunk& operator=(const Chunk&) = delete;
+  };
+
+public:
+  TileStorage();
+
+  /** Drops all tiles and sets the size to width x height */
+  void reset(int width, int height);
+
+  /** Replaces all tiles with a row-major list of width x height ids */
+  void assign(int width, int height, const std::vector<uint32_t>& tiles);
+
+  int get_width() const { return m_width; }
+  int get_height() const { return m_height; }
+
+  uint32_t get(int x, int y) const
+  {
+    assert(x >= 0 && x < m_width && y >= 0 && y < m_height);
+    const Chunk* chunk = m_chunks[(y >> CHUNK_SHIFT) * m_chunks_width + (x >> CHUNK_SHIFT)].get();
+    return chunk ? chunk->get(((y & CHUNK_MASK) << CHUNK_SHIFT) + (x & CHUNK_MASK)) : 0;
+  }
+
+  void set(int x, int y, uint32_t id);
+
+  int get_chunks_width() const { return m_chunks_width; }
+  int get_chunks_height() const { return m_chunks_height; }
+
+  /** Returns true if the chunk at chunk coordinates (cx, cy) holds no
+      tiles, so it can be skipped as a whole */
+  bool is_chunk_empty(int cx, int cy) const { return !m_chunks[cy * m_chunks_width + cx]; }
+
+  /** Returns the tiles as a row-major list of width x height ids */
+  std::vector<uint32_t> to_vector() const;
+
+  /** Number of bytes used for the tile ids */
+  size_t get_memory_usage() const;
+
+private:
+  int m_width;
+  int m_height;
+  int m_chunks_width;
+  int m_chunks_height;
+  std::vector<std::unique_ptr<Chunk> > m_chunks;
+
+private:
+  TileStorage(const TileStorage&) = delete;
+  TileStorage& operator=(const TileStorage&) = delete;
+};
+
+#endif
+
+/* EOF */
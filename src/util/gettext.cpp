@@ -17,5 +17,6 @@
 #include "util/gettext.hpp"
 
 std::unique_ptr<tinygettext::DictionaryManager> g_dictionary_manager = nullptr;
+int g_translation_generation = 0;
 
 /* EOF */
@@ -22,6 +22,18 @@
 
 extern std::unique_ptr<tinygettext::DictionaryManager> g_dictionary_manager;
 
+/** Counts the changes to the language and to the translation
+    directories of g_dictionary_manager */
+extern int g_translation_generation;
+
+/** Has to be called after changing the language or the translation
+    directories, so that TranslatedString picks up the new
+    translations */
+static inline void invalidate_translations()
+{
+  g_translation_generation += 1;
+}
+
 /*
  * If you need to do a nontrivial substitution of values into a pattern, use
  * boost::format rather than an ad-hoc concatenation.  That way, translators can
@@ -17,55 +17,466 @@
 
 #include "util/log.hpp"
 
+#include <assert.h>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <fstream>
+#include <functional>
 #include <iostream>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <string.h>
+#include <thread>
 
-#include "math/rectf.hpp"
-#include "supertux/console.hpp"
-#include "supertux/gameconfig.hpp"
-#include "supertux/globals.hpp"
+#include "util/mpmc_queue.hpp"
 
 LogLevel g_log_level = LOG_WARNING;
 
-static std::ostream& get_logging_instance (bool use_console_buffer = true)
+namespace {
+
+/** Number of messages that can be waiting for the logging thread,
+    further messages are dropped and only counted */
+const size_t QUEUE_SIZE = 4096;
+
+/** Identical messages per second and call site, further repetitions
+    within the same second are only counted */
+const int RATE_LIMIT = 20;
+
+/** Console lines kept around while nobody takes them */
+const size_t MAX_CONSOLE_LINES = 1000;
+
+const char TRACE_MAGIC[8] = { 'S', 'T', 'L', 'O', 'G', 0, 0, 1 };
+
+struct LogRecord
 {
-  if (ConsoleBuffer::current() && use_console_buffer)
-    return (ConsoleBuffer::output);
-  else
-    return (std::cerr);
+  LogLevel level = LOG_NONE;
+  const char* file = nullptr;
+  int line = 0;
+  bool use_console_buffer = false;
+  std::chrono::steady_clock::time_point time = {};
+  std::string text = {};
+};
+
+const char* get_prefix(LogLevel level)
+{
+  switch (level)
+  {
+    case LOG_FATAL: return "[FATAL]";
+    case LOG_WARNING: return "[WARNING]";
+    case LOG_INFO: return "[INFO]";
+    default: return "[DEBUG]";
+  }
 }
 
-static std::ostream& log_generic_f (const char *prefix, const char* file, int line, bool use_console_buffer = true)
+std::string format_line(LogLevel level, const char* file, int line, const std::string& text)
 {
-  get_logging_instance (use_console_buffer) << prefix << " " << file << ":" << line << " ";
-  return (get_logging_instance (use_console_buffer));
+  std::string result = get_prefix(level);
+  result += ' ';
+  result += file;
+  result += ':';
+  result += std::to_string(line);
+  result += ' ';
+  result += text;
+  return result;
 }
 
-std::ostream& log_debug_f(const char* file, int line, bool use_console_buffer = true)
+template<typename T>
+void write_value(std::ostream& out, T value)
 {
-  return (log_generic_f ("[DEBUG]", file, line, use_console_buffer));
+  out.write(reinterpret_cast<const char*>(&value), sizeof(value));
 }
 
-std::ostream& log_info_f(const char* file, int line)
+class LogThread final
 {
-  return (log_generic_f ("[INFO]", file, line));
+public:
+  LogThread() :
+    m_queue(QUEUE_SIZE),
+    m_pushed(0),
+    m_processed(0),
+    m_dropped(0),
+    m_quit(false),
+    m_mutex(),
+    m_wakeup(),
+    m_processed_cond(),
+    m_start_time(std::chrono::steady_clock::now()),
+    m_call_sites(),
+    m_output(),
+    m_trace_mutex(),
+    m_trace(),
+    m_console_mutex(),
+    m_console_lines(),
+    m_thread()
+  {
+    m_thread = std::thread(&LogThread::run, this);
+  }
+
+  ~LogThread()
+  {
+    m_quit = true;
+    m_wakeup.notify_one();
+    m_thread.join();
+  }
+
+  void push(LogRecord&& record)
+  {
+    if (record.level == LOG_FATAL)
+    {
+      // fatal errors are written out before the caller continues, as
+      // it might be about to crash
+      while (!m_queue.try_push(std::move(record)))
+      {
+        m_wakeup.notify_one();
+        std::this_thread::yield();
+      }
+      m_pushed += 1;
+      flush();
+    }
+    else if (m_queue.try_push(std::move(record)))
+    {
+      m_pushed += 1;
+    }
+    else
+    {
+      m_dropped += 1;
+    }
+  }
+
+  void flush()
+  {
+    const uint64_t target = m_pushed;
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_wakeup.notify_one();
+    m_processed_cond.wait(lock, [this, target]{ return m_processed >= target; });
+  }
+
+  void set_trace_file(const std::string& filename)
+  {
+    std::lock_guard<std::mutex> lock(m_trace_mutex);
+    m_trace.close();
+    m_trace.clear();
+    if (filename.empty())
+      return;
+
+    m_trace.open(filename, std::ios::binary | std::ios::trunc);
+    if (!m_trace)
+    {
+      std::cerr << "[WARNING] Couldn't open log trace file " << filename << std::endl;
+      return;
+    }
+    m_trace.write(TRACE_MAGIC, sizeof(TRACE_MAGIC));
+  }
+
+  bool take_console_lines(std::vector<LogConsoleLine>& lines)
+  {
+    std::lock_guard<std::mutex> lock(m_console_mutex);
+    if (m_console_lines.empty())
+      return false;
+
+    lines.insert(lines.end(),
+                 std::make_move_iterator(m_console_lines.begin()),
+                 std::make_move_iterator(m_console_lines.end()));
+    m_console_lines.clear();
+    return true;
+  }
+
+private:
+  struct CallSite
+  {
+    std::chrono::steady_clock::time_point window_start = {};
+    /** Hash of the last text, only repetitions of it are limited */
+    size_t text_hash = 0;
+    int count = 0;
+    int suppressed = 0;
+    LogLevel level = LOG_NONE;
+    bool use_console_buffer = false;
+  };
+
+  void run()
+  {
+    while (true)
+    {
+      const bool quit = m_quit;
+      drain();
+
+      std::unique_lock<std::mutex> lock(m_mutex);
+      m_processed_cond.notify_all();
+      if (quit)
+        break;
+
+      m_wakeup.wait_for(lock, std::chrono::milliseconds(10));
+    }
+
+    for (auto& it : m_call_sites) {
+      write_suppressed(it.first.first, it.first.second, it.second);
+    }
+    write_output();
+  }
+
+  void drain()
+  {
+    LogRecord record;
+    while (m_queue.try_pop(record))
+    {
+      write(record);
+      m_processed += 1;
+    }
+
+    const uint64_t dropped = m_dropped.exchange(0);
+    if (dropped > 0)
+    {
+      m_output += "[WARNING] " + std::to_string(dropped) + " log messages dropped, the log queue was full\n";
+    }
+
+    write_output();
+  }
+
+  void write(const LogRecord& record)
+  {
+    write_trace(record);
+
+    if (record.level != LOG_FATAL)
+    {
+      CallSite& site = m_call_sites[std::make_pair(record.file, record.line)];
+      const size_t text_hash = std::hash<std::string>()(record.text);
+      if (text_hash != site.text_hash ||
+          record.time - site.window_start >= std::chrono::seconds(1))
+      {
+        write_suppressed(record.file, record.line, site);
+        site.window_start = record.time;
+        site.text_hash = text_hash;
+        site.count = 0;
+      }
+
+      site.count += 1;
+      if (site.count > RATE_LIMIT)
+      {
+        site.suppressed += 1;
+        site.level = record.level;
+        site.use_console_buffer = record.use_console_buffer;
+        return;
+      }
+    }
+
+    write_line(record.level, record.use_console_buffer,
+               format_line(record.level, record.file, record.line, record.text));
+  }
+
+  void write_suppressed(const char* file, int line, CallSite& site)
+  {
+    if (site.suppressed == 0)
+      return;
+
+    write_line(site.level, site.use_console_buffer,
+               format_line(site.level, file, line,
+                           std::to_string(site.suppressed) + " repeated messages suppressed"));
+    site.suppressed = 0;
+  }
+
+  void write_line(LogLevel level, bool use_console_buffer, std::string&& text)
+  {
+    m_output += text;
+    m_output += '\n';
+
+    if (use_console_buffer)
+    {
+      std::lock_guard<std::mutex> lock(m_console_mutex);
+      if (m_console_lines.size() >= MAX_CONSOLE_LINES) {
+        m_console_lines.pop_front();
+      }
+      m_console_lines.push_back({ level, std::move(text) });
+    }
+  }
+
+  void write_output()
+  {
+    if (m_output.empty())
+      return;
+
+    // a single write, as std::cerr flushes after every operation
+    std::cerr.write(m_output.data(), static_cast<std::streamsize>(m_output.size()));
+    m_output.clear();
+  }
+
+  /** Record layout, in native byte order: uint64 microseconds since
+      startup, uint8 level, uint32 line, uint32 length of the file name,
+      uint32 length of the text, followed by the file name and the text */
+  void write_trace(const LogRecord& record)
+  {
+    std::lock_guard<std::mutex> lock(m_trace_mutex);
+    if (!m_trace.is_open())
+      return;
+
+    const auto time = std::chrono::duration_cast<std::chrono::microseconds>(record.time - m_start_time);
+    const uint32_t file_length = static_cast<uint32_t>(strlen(record.file));
+
+    write_value<uint64_t>(m_trace, static_cast<uint64_t>(time.count()));
+    write_value<uint8_t>(m_trace, static_cast<uint8_t>(record.level));
+    write_value<uint32_t>(m_trace, static_cast<uint32_t>(record.line));
+    write_value<uint32_t>(m_trace, file_length);
+    write_value<uint32_t>(m_trace, static_cast<uint32_t>(record.text.size()));
+    m_trace.write(record.file, file_length);
+    m_trace.write(record.text.data(), static_cast<std::streamsize>(record.text.size()));
+  }
+
+private:
+  MPMCQueue<LogRecord> m_queue;
+  std::atomic<uint64_t> m_pushed;
+  std::atomic<uint64_t> m_processed;
+  std::atomic<uint64_t> m_dropped;
+  std::atomic<bool> m_quit;
+
+  std::mutex m_mutex;
+  std::condition_variable m_wakeup;
+  std::condition_variable m_processed_cond;
+
+  // only touched by the logging thread
+  const std::chrono::steady_clock::time_point m_start_time;
+  std::map<std::pair<const char*, int>, CallSite> m_call_sites;
+  std::string m_output;
+
+  std::mutex m_trace_mutex;
+  std::ofstream m_trace;
+
+  std::mutex m_console_mutex;
+  std::deque<LogConsoleLine> m_console_lines;
+
+  std::thread m_thread;
+
+private:
+  LogThread(const LogThread&) = delete;
+  LogThread& operator=(const LogThread&) = delete;
+};
+
+std::unique_ptr<LogThread> s_log_thread_instance;
+std::atomic<LogThread*> s_log_thread(nullptr);
+
+std::vector<std::string> s_muted_categories;
+
+/** Reused by all log statements of a thread, constructing a stream
+    for every message is surprisingly expensive */
+thread_local std::ostringstream t_stream;
+thread_local bool t_stream_in_use = false;
+
+} // namespace
+
+LogMessage::LogMessage(LogLevel level, const char* file, int line, bool use_console_buffer) :
+  m_level(level),
+  m_file(file),
+  m_line(line),
+  m_use_console_buffer(use_console_buffer),
+  m_own_stream(),
+  m_stream(nullptr)
+{
+  if (!t_stream_in_use)
+  {
+    t_stream_in_use = true;
+    m_stream = &t_stream;
+  }
+  else
+  {
+    m_own_stream.reset(new std::ostringstream);
+    m_stream = m_own_stream.get();
+  }
 }
 
-std::ostream& log_warning_f(const char* file, int line)
+LogMessage::~LogMessage()
 {
-  if (g_config && g_config->developer_mode &&
-     Console::current() && !Console::current()->hasFocus()) {
-    Console::current()->open();
+  LogRecord record;
+  record.level = m_level;
+  record.file = m_file;
+  record.line = m_line;
+  record.use_console_buffer = m_use_console_buffer;
+  record.time = std::chrono::steady_clock::now();
+
+  if (m_own_stream)
+  {
+    record.text = m_own_stream->str();
+  }
+  else
+  {
+    record.text = t_stream.str();
+    t_stream.str(std::string());
+    t_stream.clear();
+    t_stream.flags(std::ios_base::skipws | std::ios_base::dec);
+    t_stream.precision(6);
+    t_stream.width(0);
+    t_stream.fill(' ');
+    t_stream_in_use = false;
   }
-  return (log_generic_f ("[WARNING]", file, line));
+
+  while (!record.text.empty() && (record.text.back() == '\n' || record.text.back() == '\r')) {
+    record.text.pop_back();
+  }
+
+  if (LogThread* thread = s_log_thread)
+  {
+    thread->push(std::move(record));
+  }
+  else
+  {
+    std::cerr << format_line(record.level, record.file, record.line, record.text) << std::endl;
+  }
+}
+
+void
+log_start_thread()
+{
+  assert(!s_log_thread_instance);
+  s_log_thread_instance.reset(new LogThread);
+  s_log_thread = s_log_thread_instance.get();
+}
+
+void
+log_stop_thread()
+{
+  s_log_thread = nullptr;
+  s_log_thread_instance.reset();
+}
+
+void
+log_flush()
+{
+  if (LogThread* thread = s_log_thread)
+    thread->flush();
 }
 
-std::ostream& log_fatal_f(const char* file, int line)
+void
+log_set_trace_file(const std::string& filename)
 {
-  if (g_config && g_config->developer_mode &&
-     Console::current() && !Console::current()->hasFocus()) {
-    Console::current()->open();
+  if (LogThread* thread = s_log_thread)
+    thread->set_trace_file(filename);
+}
+
+void
+log_mute_category(const std::string& category)
+{
+  s_muted_categories.push_back("src/" + category + "/");
+  s_muted_categories.push_back("src\\" + category + "\\");
+}
+
+bool
+log_is_muted(LogLevel level, const char* file)
+{
+  if (s_muted_categories.empty() || level == LOG_FATAL)
+    return false;
+
+  for (const auto& category : s_muted_categories) {
+    if (strstr(file, category.c_str()))
+      return true;
   }
-  return (log_generic_f ("[FATAL]", file, line));
+  return false;
+}
+
+bool
+log_take_console_lines(std::vector<LogConsoleLine>& lines)
+{
+  if (LogThread* thread = s_log_thread)
+    return thread->take_console_lines(lines);
+  else
+    return false;
 }
 
 /* Callbacks used by tinygettext */
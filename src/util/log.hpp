@@ -17,23 +17,89 @@
 #ifndef HEADER_SUPERTUX_UTIL_LOG_HPP
 #define HEADER_SUPERTUX_UTIL_LOG_HPP
 
+#include <iosfwd>
+#include <memory>
 #include <ostream>
+#include <string>
+#include <vector>
 
 enum LogLevel { LOG_NONE, LOG_FATAL, LOG_WARNING, LOG_INFO, LOG_DEBUG };
 extern LogLevel g_log_level;
 
-std::ostream& log_debug_f(const char* file, int line, bool use_console_buffer);
-#define log_debug if (g_log_level >= LOG_DEBUG) log_debug_f(__FILE__, __LINE__, true)
-#define log_debug_ if (g_log_level >= LOG_DEBUG) log_debug_f(__FILE__, __LINE__, false)
+/** Log statements above this level are removed at compile time,
+    e.g. build with -DSUPERTUX_LOG_MAX_LEVEL=LOG_INFO to drop all
+    debug output from a release build */
+#ifndef SUPERTUX_LOG_MAX_LEVEL
+#  define SUPERTUX_LOG_MAX_LEVEL LOG_DEBUG
+#endif
+
+/** Collects the text of a single log statement and passes it on to
+    the logging thread at the end of the statement */
+class LogMessage final
+{
+public:
+  LogMessage(LogLevel level, const char* file, int line, bool use_console_buffer = true);
+  ~LogMessage();
+
+  std::ostream& get_stream() { return *m_stream; }
+
+private:
+  const LogLevel m_level;
+  const char* const m_file;
+  const int m_line;
+  const bool m_use_console_buffer;
+
+  /** only used when a log statement is evaluated while another one
+      on the same thread is still being built */
+  std::unique_ptr<std::ostringstream> m_own_stream;
+  std::ostream* m_stream;
+
+private:
+  LogMessage(const LogMessage&) = delete;
+  LogMessage& operator=(const LogMessage&) = delete;
+};
+
+#define SUPERTUX_LOG(level, use_console_buffer) \
+  if ((level) > SUPERTUX_LOG_MAX_LEVEL || g_log_level < (level) || log_is_muted((level), __FILE__)) {} \
+  else LogMessage((level), __FILE__, __LINE__, (use_console_buffer)).get_stream()
+
+#define log_debug SUPERTUX_LOG(LOG_DEBUG, true)
+#define log_debug_ SUPERTUX_LOG(LOG_DEBUG, false)
+#define log_info SUPERTUX_LOG(LOG_INFO, true)
+#define log_warning SUPERTUX_LOG(LOG_WARNING, true)
+#define log_fatal SUPERTUX_LOG(LOG_FATAL, true)
+
+/** A message that was meant for the console, see log_take_console_lines() */
+struct LogConsoleLine
+{
+  LogLevel level;
+  std::string text;
+};
+
+/** Starts the background thread that writes log messages. Until it
+    is started, and again after log_stop_thread(), messages are written
+    synchronously to stderr. */
+void log_start_thread();
+
+/** Writes out all pending messages and stops the logging thread */
+void log_stop_thread();
+
+/** Blocks until all messages logged so far have been written */
+void log_flush();
 
-std::ostream& log_info_f(const char* file, int line);
-#define log_info if (g_log_level >= LOG_INFO) log_info_f(__FILE__, __LINE__)
+/** Additionally writes every message in a compact binary format to
+    'filename', an empty filename closes the trace */
+void log_set_trace_file(const std::string& filename);
 
-std::ostream& log_warning_f(const char* file, int line);
-#define log_warning if (g_log_level >= LOG_WARNING) log_warning_f(__FILE__, __LINE__)
+/** Drops all messages from source files in the given directory below
+    src/, e.g. "audio" or "object". Fatal errors are never muted. Has
+    to be called during startup, before other threads log anything. */
+void log_mute_category(const std::string& category);
+bool log_is_muted(LogLevel level, const char* file);
 
-std::ostream& log_fatal_f(const char* file, int line);
-#define log_fatal if (g_log_level >= LOG_FATAL) log_fatal_f(__FILE__, __LINE__)
+/** Moves the messages meant for the console that arrived since the
+    last call into 'lines', returns false if there were none */
+bool log_take_console_lines(std::vector<LogConsoleLine>& lines);
 
 void log_info_callback(const std::string& str);
 void log_error_callback(const std::string& str);
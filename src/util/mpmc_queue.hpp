@@ -0,0 +1,119 @@
+//  SuperTux
+//  Copyright (C) 2020 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef HEADER_SUPERTUX_UTIL_MPMC_QUEUE_HPP
+#define HEADER_SUPERTUX_UTIL_MPMC_QUEUE_HPP
+
+#include <assert.h>
+#include <atomic>
+#include <memory>
+#include <stddef.h>
+
+/** Bounded lock-free queue for any number of producer and consumer
+    threads. Every slot carries a sequence number that tells whether
+    it is ready to be written or read in the current lap around the
+    ring, so threads only contend on the two position counters. */
+template<typename T>
+class MPMCQueue final
+{
+public:
+  /** 'capacity' has to be a power of two */
+  explicit MPMCQueue(size_t capacity) :
+    m_cells(new Cell[capacity]),
+    m_mask(capacity - 1),
+    m_enqueue_pos(0),
+    m_dequeue_pos(0)
+  {
+    assert(capacity >= 2 && (capacity & (capacity - 1)) == 0);
+
+    for (size_t i = 0; i < capacity; ++i) {
+      m_cells[i].sequence.store(i, std::memory_order_relaxed);
+    }
+  }
+
+  /** Returns false without touching 'value' if the queue is full */
+  bool try_push(T&& value)
+  {
+    Cell* cell;
+    size_t pos = m_enqueue_pos.load(std::memory_order_relaxed);
+    while (true)
+    {
+      cell = &m_cells[pos & m_mask];
+      const size_t seq = cell->sequence.load(std::memory_order_acquire);
+      const ptrdiff_t diff = static_cast<ptrdiff_t>(seq) - static_cast<ptrdiff_t>(pos);
+      if (diff == 0) {
+        if (m_enqueue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+          break;
+        }
+      } else if (diff < 0) {
+        return false;
+      } else {
+        pos = m_enqueue_pos.load(std::memory_order_relaxed);
+      }
+    }
+
+    cell->data = std::move(value);
+    cell->sequence.store(pos + 1, std::memory_order_release);
+    return true;
+  }
+
+  /** Returns false if the queue is empty */
+  bool try_pop(T& value)
+  {
+    Cell* cell;
+    size_t pos = m_dequeue_pos.load(std::memory_order_relaxed);
+    while (true)
+    {
+      cell = &m_cells[pos & m_mask];
+      const size_t seq = cell->sequence.load(std::memory_order_acquire);
+      const ptrdiff_t diff = static_cast<ptrdiff_t>(seq) - static_cast<ptrdiff_t>(pos + 1);
+      if (diff == 0) {
+        if (m_dequeue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+          break;
+        }
+      } else if (diff < 0) {
+        return false;
+      } else {
+        pos = m_dequeue_pos.load(std::memory_order_relaxed);
+      }
+    }
+
+    value = std::move(cell->data);
+    cell->sequence.store(pos + m_mask + 1, std::memory_order_release);
+    return true;
+  }
+
+private:
+  struct Cell
+  {
+    std::atomic<size_t> sequence;
+    T data;
+  };
+
+private:
+  std::unique_ptr<Cell[]> m_cells;
+  const size_t m_mask;
+  std::atomic<size_t> m_enqueue_pos;
+  std::atomic<size_t> m_dequeue_pos;
+
+private:
+  MPMCQueue(const MPMCQueue&) = delete;
+  MPMCQueue& operator=(const MPMCQueue&) = delete;
+};
+
+#endif
+
+/* EOF */
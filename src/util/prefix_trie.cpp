@@ -0,0 +1,121 @@
+//  SuperTux
+//  Copyright (C) 2020 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "util/prefix_trie.hpp"
+
+PrefixTrie::PrefixTrie() :
+  m_root()
+{
+}
+
+void
+PrefixTrie::add(const std::string& key)
+{
+  Node* node = &m_root;
+  for (const char c : key)
+  {
+    auto& child = node->children[c];
+    if (!child) {
+      child = std::make_unique<Node>();
+    }
+    node = child.get();
+  }
+  node->count += 1;
+}
+
+void
+PrefixTrie::remove(const std::string& key)
+{
+  // remember the path, so that nodes left empty can be pruned
+  std::vector<Node*> path;
+  path.reserve(key.size() + 1);
+  path.push_back(&m_root);
+  for (const char c : key)
+  {
+    auto it = path.back()->children.find(c);
+    if (it == path.back()->children.end())
+      return;
+    path.push_back(it->second.get());
+  }
+
+  if (path.back()->count == 0)
+    return;
+  path.back()->count -= 1;
+
+  for (size_t i = key.size(); i > 0; --i)
+  {
+    const Node& node = *path[i];
+    if (node.count > 0 || !node.children.empty())
+      break;
+    path[i - 1]->children.erase(key[i - 1]);
+  }
+}
+
+void
+PrefixTrie::clear()
+{
+  m_root.children.clear();
+  m_root.count = 0;
+}
+
+bool
+PrefixTrie::contains(const std::string& key) const
+{
+  const Node* node = find_node(key);
+  return node && node->count > 0;
+}
+
+void
+PrefixTrie::find(const std::string& prefix, std::vector<std::string>& result) const
+{
+  const Node* node = find_node(prefix);
+  if (!node)
+    return;
+
+  std::string key = prefix;
+  collect(*node, key, result);
+}
+
+const PrefixTrie::Node*
+PrefixTrie::find_node(const std::string& key) const
+{
+  const Node* node = &m_root;
+  for (const char c : key)
+  {
+    auto it = node->children.find(c);
+    if (it == node->children.end())
+      return nullptr;
+    node = it->second.get();
+  }
+  return node;
+}
+
+void
+PrefixTrie::collect(const Node& node, std::string& key, std::vector<std::string>& result)
+{
+  if (node.count > 0) {
+    result.push_back(key);
+  }
+
+  for (const auto& it : node.children)
+  {
+    key.push_back(it.first);
+    collect(*it.second, key, result);
+    key.pop_back();
+  }
+}
+
+/* EOF */
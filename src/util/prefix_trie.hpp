@@ -0,0 +1,66 @@
+//  SuperTux
+//  Copyright (C) 2020 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef HEADER_SUPERTUX_UTIL_PREFIX_TRIE_HPP
+#define HEADER_SUPERTUX_UTIL_PREFIX_TRIE_HPP
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+/** Set of strings that can be searched by prefix. Keys are counted,
+    so a key added twice has to be removed twice. */
+class PrefixTrie final
+{
+public:
+  PrefixTrie();
+
+  void add(const std::string& key);
+  void remove(const std::string& key);
+  void clear();
+
+  bool empty() const { return m_root.children.empty() && m_root.count == 0; }
+
+  /** Returns true if 'key' itself was added, not just a longer key */
+  bool contains(const std::string& key) const;
+
+  /** Appends all keys that start with 'prefix' to 'result', in
+      lexicographic order */
+  void find(const std::string& prefix, std::vector<std::string>& result) const;
+
+private:
+  struct Node
+  {
+    std::map<char, std::unique_ptr<Node> > children;
+    int count = 0;
+  };
+
+  /** Returns the node for 'key' or nullptr if no key starts with it */
+  const Node* find_node(const std::string& key) const;
+  static void collect(const Node& node, std::string& key, std::vector<std::string>& result);
+
+private:
+  Node m_root;
+
+private:
+  PrefixTrie(const PrefixTrie&) = delete;
+  PrefixTrie& operator=(const PrefixTrie&) = delete;
+};
+
+#endif
+
+/* EOF */
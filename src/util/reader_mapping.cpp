@@ -192,6 +192,24 @@ ReaderMapping::get(const char* key, std::vector<unsigned int>& value) const
 
 #undef GET_VALUES_MACRO
 
+bool
+ReaderMapping::get_each(const char* key, const std::function<void (uint32_t)>& func) const
+{
+  auto const sx = get_item(key);
+  if (!sx) {
+    return false;
+  } else {
+    assert_is_array(m_doc, *sx);
+    auto const& item = sx->as_array();
+    for (size_t i = 1; i < item.size(); ++i)
+    {
+      assert_is_integer(m_doc, item[i]);
+      func(static_cast<uint32_t>(item[i].as_int()));
+    }
+    return true;
+  }
+}
+
 bool
 ReaderMapping::get(const char* key, boost::optional<ReaderMapping>& value) const
 {
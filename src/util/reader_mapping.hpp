@@ -18,6 +18,7 @@
 #define HEADER_SUPERTUX_UTIL_READER_MAPPING_HPP
 
 #include <boost/optional.hpp>
+#include <functional>
 
 #include "util/reader_iterator.hpp"
 
@@ -56,6 +57,11 @@ public:
 
   bool get(const char* key, sexp::Value& value) const;
 
+  /** Passes the elements of an integer list to func one by one,
+      instead of collecting them in a std::vector first. Used for huge
+      lists, such as the tiles of a tilemap. */
+  bool get_each(const char* key, const std::function<void (uint32_t)>& func) const;
+
   /** Read a custom data format, such an as enum. The data is stored
       as string and converted to the custom type using the supplied
       `from_string` convert function. Example:
@@ -0,0 +1,143 @@
+//  SuperTux
+//  Copyright (C) 2020 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "util/thread_pool.hpp"
+
+ThreadPool::ThreadPool(int num_threads) :
+  m_threads(),
+  m_mutex(),
+  m_job_cond(),
+  m_done_cond(),
+  m_generation(0),
+  m_quit(false),
+  m_func(nullptr),
+  m_count(0),
+  m_next(0),
+  m_busy(0),
+  m_exception()
+{
+  for (int i = 0; i < num_threads; ++i)
+  {
+    m_threads.emplace_back(&ThreadPool::run_worker, this);
+  }
+}
+
+ThreadPool::~ThreadPool()
+{
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_quit = true;
+  }
+  m_job_cond.notify_all();
+
+  for (auto& thread : m_threads)
+  {
+    thread.join();
+  }
+}
+
+void
+ThreadPool::parallel_for(size_t count, const std::function<void (size_t)>& func)
+{
+  if (count == 0)
+    return;
+
+  if (m_threads.empty() || count == 1)
+  {
+    for (size_t i = 0; i < count; ++i)
+    {
+      func(i);
+    }
+    return;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_func = &func;
+    m_count = count;
+    m_next = 0;
+    m_busy = static_cast<int>(m_threads.size());
+    m_exception = nullptr;
+    m_generation += 1;
+  }
+  m_job_cond.notify_all();
+
+  run_job();
+
+  std::exception_ptr exception;
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_done_cond.wait(lock, [this]{ return m_busy == 0; });
+    m_func = nullptr;
+    exception = m_exception;
+    m_exception = nullptr;
+  }
+
+  if (exception)
+  {
+    std::rethrow_exception(exception);
+  }
+}
+
+void
+ThreadPool::run_worker()
+{
+  unsigned int generation = 0;
+  while (true)
+  {
+    {
+      std::unique_lock<std::mutex> lock(m_mutex);
+      m_job_cond.wait(lock, [this, generation]{ return m_quit || m_generation != generation; });
+      if (m_quit)
+        return;
+      generation = m_generation;
+    }
+
+    run_job();
+
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_busy -= 1;
+    }
+    m_done_cond.notify_one();
+  }
+}
+
+void
+ThreadPool::run_job()
+{
+  while (true)
+  {
+    const size_t i = m_next.fetch_add(1);
+    if (i >= m_count)
+      return;
+
+    try
+    {
+      (*m_func)(i);
+    }
+    catch(...)
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      if (!m_exception)
+      {
+        m_exception = std::current_exception();
+      }
+    }
+  }
+}
+
+/* EOF */
@@ -0,0 +1,77 @@
+//  SuperTux
+//  Copyright (C) 2020 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef HEADER_SUPERTUX_UTIL_THREAD_POOL_HPP
+#define HEADER_SUPERTUX_UTIL_THREAD_POOL_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/** A fixed set of worker threads for splitting a loop into parallel
+    parts. Workers and the calling thread take the next index from a
+    shared counter, so whoever finishes early takes over the remaining
+    work. */
+class ThreadPool final
+{
+public:
+  /** Starts 'num_threads' workers, the thread that calls
+      parallel_for() does its share of the work too */
+  ThreadPool(int num_threads);
+  ~ThreadPool();
+
+  /** Calls func(i) for every i in [0, count) and returns once all
+      calls are done. The first exception thrown by func is rethrown
+      here, the remaining indices are still processed. */
+  void parallel_for(size_t count, const std::function<void (size_t)>& func);
+
+  int get_thread_count() const { return static_cast<int>(m_threads.size()); }
+
+private:
+  void run_worker();
+  void run_job();
+
+private:
+  std::vector<std::thread> m_threads;
+
+  std::mutex m_mutex;
+  std::condition_variable m_job_cond;
+  std::condition_variable m_done_cond;
+
+  /** Incremented for every parallel_for() call, wakes the workers */
+  unsigned int m_generation;
+  bool m_quit;
+
+  const std::function<void (size_t)>* m_func;
+  size_t m_count;
+  std::atomic<size_t> m_next;
+
+  /** Workers that haven't finished the current job yet */
+  int m_busy;
+  std::exception_ptr m_exception;
+
+private:
+  ThreadPool(const ThreadPool&) = delete;
+  ThreadPool& operator=(const ThreadPool&) = delete;
+};
+
+#endif
+
+/* EOF */
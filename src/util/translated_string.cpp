@@ -0,0 +1,33 @@
+//  SuperTux
+//  Copyright (C) 2020 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "util/translated_string.hpp"
+
+TranslatedString::TranslatedString(const std::string& message) :
+  m_message(message),
+  m_translation(),
+  m_generation(g_translation_generation - 1)
+{
+}
+
+void
+TranslatedString::update() const
+{
+  m_translation = _(m_message);
+  m_generation = g_translation_generation;
+}
+
+/* EOF */
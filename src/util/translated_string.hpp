@@ -0,0 +1,62 @@
+//  SuperTux
+//  Copyright (C) 2020 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef HEADER_SUPERTUX_UTIL_TRANSLATED_STRING_HPP
+#define HEADER_SUPERTUX_UTIL_TRANSLATED_STRING_HPP
+
+#include <string>
+
+#include "util/gettext.hpp"
+
+/** A message that is translated on first use and again only after
+    invalidate_translations(), while _() looks the message up and
+    copies the translation on every call. Meant for constant labels
+    that are drawn every frame:
+
+      static const TranslatedString s_coins = TranslatedString("Coins");
+      canvas.draw_text(font, s_coins, ...);
+
+    Writing the message as TranslatedString("...") lets xgettext find
+    it. */
+class TranslatedString final
+{
+public:
+  explicit TranslatedString(const std::string& message);
+
+  const std::string& get() const
+  {
+    if (m_generation != g_translation_generation) {
+      update();
+    }
+    return m_translation;
+  }
+
+  operator const std::string&() const { return get(); }
+
+  const std::string& get_message() const { return m_message; }
+
+private:
+  void update() const;
+
+private:
+  std::string m_message;
+  mutable std::string m_translation;
+  mutable int m_generation;
+};
+
+#endif
+
+/* EOF */
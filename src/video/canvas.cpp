@@ -17,6 +17,7 @@
 #include "video/canvas.hpp"
 
 #include <algorithm>
+#include <math.h>
 
 #include "supertux/globals.hpp"
 #include "util/log.hpp"
@@ -25,12 +26,16 @@
 #include "video/painter.hpp"
 #include "video/renderer.hpp"
 #include "video/surface.hpp"
+#include "video/texture.hpp"
 #include "video/video_system.hpp"
 
 Canvas::Canvas(DrawingContext& context, obstack& obst) :
   m_context(context),
   m_obst(obst),
-  m_requests()
+  m_requests(),
+  m_has_displacement(false),
+  m_batch_additive(false),
+  m_additive_batches()
 {
 }
 
@@ -47,6 +52,8 @@ Canvas::clear()
     request->~DrawingRequest();
   }
   m_requests.clear();
+  m_additive_batches.clear();
+  m_has_displacement = false;
 }
 
 void
@@ -118,6 +125,11 @@ Canvas::draw_surface(const SurfacePtr& surface,
      position.y + static_cast<float>(surface->get_height()) < cliprect.get_top())
     return;
 
+  if (batch_additive(surface, Rectf(surface->get_region()),
+                     Rectf(position, Size(surface->get_width(), surface->get_height())),
+                     angle, color, blend, layer))
+    return;
+
   auto request = new(m_obst) TextureRequest();
 
   request->type = TEXTURE;
@@ -131,6 +143,9 @@ Canvas::draw_surface(const SurfacePtr& surface,
   request->angles.emplace_back(angle);
   request->texture = surface->get_texture().get();
   request->displacement_texture = surface->get_displacement_texture().get();
+  if (request->displacement_texture) {
+    m_has_displacement = true;
+  }
   request->color = color;
 
   m_requests.push_back(request);
@@ -156,6 +171,11 @@ Canvas::draw_surface_part(const SurfacePtr& surface, const Rectf& srcrect, const
 {
   if (!surface) return;
 
+  Color color = style.get_color();
+  color.alpha *= style.get_alpha();
+  if (batch_additive(surface, srcrect, dstrect, 0.0f, color, style.get_blend(), layer))
+    return;
+
   auto request = new(m_obst) TextureRequest();
 
   request->type = TEXTURE;
@@ -169,6 +189,82 @@ Canvas::draw_surface_part(const SurfacePtr& surface, const Rectf& srcrect, const
   request->angles.emplace_back(0.0f);
   request->texture = surface->get_texture().get();
   request->displacement_texture = surface->get_displacement_texture().get();
+  if (request->displacement_texture) {
+    m_has_displacement = true;
+  }
+  request->color = style.get_color();
+
+  m_requests.push_back(request);
+}
+
+void
+Canvas::draw_surface_repeat(const SurfacePtr& surface, const Rectf& dstrect, const Vector& origin,
+                            int layer, const PaintStyle& style)
+{
+  if (!surface) return;
+
+  const Rect region = surface->get_region();
+  const float width = static_cast<float>(region.get_width());
+  const float height = static_cast<float>(region.get_height());
+  if (width <= 0.0f || height <= 0.0f ||
+      dstrect.get_width() <= 0.0f || dstrect.get_height() <= 0.0f) return;
+
+  // position of dstrect within the copy it starts in
+  const float offset_x = dstrect.get_left() - origin.x - floorf((dstrect.get_left() - origin.x) / width) * width;
+  const float offset_y = dstrect.get_top() - origin.y - floorf((dstrect.get_top() - origin.y) / height) * height;
+
+  const Flip flip = m_context.transform().flip ^ surface->get_flip();
+  const Texture& texture = *surface->get_texture();
+
+  if (texture.supports_repeat() &&
+      flip == NO_FLIP &&
+      !surface->get_displacement_texture() &&
+      region == Rect(0, 0, texture.get_image_width(), texture.get_image_height()))
+  {
+    draw_surface_part(surface, Rectf(Vector(offset_x, offset_y), dstrect.get_size()), dstrect, layer, style);
+    return;
+  }
+
+  auto request = new(m_obst) TextureRequest();
+
+  request->type = TEXTURE;
+  request->layer = layer;
+  request->flip = flip;
+  request->alpha = m_context.transform().alpha * style.get_alpha();
+  request->blend = style.get_blend();
+
+  const float start_x = dstrect.get_left() - offset_x;
+  const float start_y = dstrect.get_top() - offset_y;
+  for (int y = 0; start_y + static_cast<float>(y) * height < dstrect.get_bottom(); ++y)
+  {
+    for (int x = 0; start_x + static_cast<float>(x) * width < dstrect.get_right(); ++x)
+    {
+      const float left = start_x + static_cast<float>(x) * width;
+      const float top = start_y + static_cast<float>(y) * height;
+
+      // copies at the border only get drawn partially
+      const Rectf part(std::max(left, dstrect.get_left()),
+                       std::max(top, dstrect.get_top()),
+                       std::min(left + width, dstrect.get_right()),
+                       std::min(top + height, dstrect.get_bottom()));
+
+      // the painter flips the source rectangle, not the whole copy
+      const float src_left = (flip & HORIZONTAL_FLIP) ? left + width - part.get_right() : part.get_left() - left;
+      const float src_top = (flip & VERTICAL_FLIP) ? top + height - part.get_bottom() : part.get_top() - top;
+
+      request->srcrects.emplace_back(Vector(static_cast<float>(region.left) + src_left,
+                                            static_cast<float>(region.top) + src_top),
+                                     part.get_size());
+      request->dstrects.emplace_back(apply_translate(part.p1()), part.get_size());
+      request->angles.emplace_back(0.0f);
+    }
+  }
+
+  request->texture = surface->get_texture().get();
+  request->displacement_texture = surface->get_displacement_texture().get();
+  if (request->displacement_texture) {
+    m_has_displacement = true;
+  }
   request->color = style.get_color();
 
   m_requests.push_back(request);
@@ -218,6 +314,9 @@ Canvas::draw_surface_batch(const SurfacePtr& surface,
 
   request->texture = surface->get_texture().get();
   request->displacement_texture = surface->get_displacement_texture().get();
+  if (request->displacement_texture) {
+    m_has_displacement = true;
+  }
 
   m_requests.push_back(request);
 }
@@ -371,6 +470,72 @@ Canvas::get_pixel(const Vector& position, const std::shared_ptr<Color>& color_ou
   m_requests.push_back(request);
 }
 
+bool
+Canvas::batch_additive(const SurfacePtr& surface, const Rectf& srcrect, const Rectf& dstrect,
+                       float angle, const Color& color, const Blend& blend, int layer)
+{
+  if (!m_batch_additive || blend != Blend::ADD || surface->get_displacement_texture())
+    return false;
+
+  // Additive quads can be drawn in any order, but not across other
+  // requests, so once another request was added the open batches are
+  // closed.
+  if (!m_requests.empty() &&
+      std::find(m_additive_batches.begin(), m_additive_batches.end(), m_requests.back()) == m_additive_batches.end())
+  {
+    m_additive_batches.clear();
+  }
+
+  const auto& cliprect = m_context.get_cliprect();
+  if (dstrect.get_left() > cliprect.get_right() ||
+      dstrect.get_top() > cliprect.get_bottom() ||
+      dstrect.get_right() < cliprect.get_left() ||
+      dstrect.get_bottom() < cliprect.get_top())
+  {
+    // the light does not reach into the screen
+    return true;
+  }
+
+  const Texture* texture = surface->get_texture().get();
+  const Flip flip = m_context.transform().flip ^ surface->get_flip();
+  const float alpha = m_context.transform().alpha;
+
+  auto it = std::find_if(m_additive_batches.begin(), m_additive_batches.end(),
+                         [texture, flip, alpha, layer](const TextureRequest* batch) {
+                           return (batch->texture == texture &&
+                                   batch->flip == flip &&
+                                   batch->alpha == alpha &&
+                                   batch->layer == layer);
+                         });
+
+  TextureRequest* request;
+  if (it != m_additive_batches.end())
+  {
+    request = *it;
+  }
+  else
+  {
+    request = new(m_obst) TextureRequest();
+
+    request->type = TEXTURE;
+    request->layer = layer;
+    request->flip = flip;
+    request->alpha = alpha;
+    request->blend = blend;
+    request->texture = texture;
+
+    m_requests.push_back(request);
+    m_additive_batches.push_back(request);
+  }
+
+  request->srcrects.emplace_back(srcrect);
+  request->dstrects.emplace_back(apply_translate(dstrect.p1()), dstrect.get_size());
+  request->angles.emplace_back(angle);
+  request->colors.emplace_back(color);
+
+  return true;
+}
+
 Vector
 Canvas::apply_translate(const Vector& pos) const
 {
@@ -39,6 +39,7 @@ class DrawingContext;
 class Renderer;
 class VideoSystem;
 struct DrawingRequest;
+struct TextureRequest;
 
 class Canvas final
 {
@@ -56,6 +57,12 @@ public:
                          int layer, const PaintStyle& style = PaintStyle());
   void draw_surface_scaled(const SurfacePtr& surface, const Rectf& dstrect,
                            int layer, const PaintStyle& style = PaintStyle());
+
+  /** Fills dstrect with copies of the surface, one of which has its
+      top left corner at origin. Textures that support repeating are
+      drawn with a single quad, others with one quad per copy. */
+  void draw_surface_repeat(const SurfacePtr& surface, const Rectf& dstrect, const Vector& origin,
+                           int layer, const PaintStyle& style = PaintStyle());
   void draw_surface_batch(const SurfacePtr& surface,
                           std::vector<Rectf> srcrects,
                           std::vector<Rectf> dstrects,
@@ -88,15 +95,35 @@ public:
   void clear();
   void render(Renderer& renderer, Filter filter);
 
+  /** Returns true if any request uses a displacement texture, which
+      needs the back buffer to be available */
+  bool has_displacement() const { return m_has_displacement; }
+
   DrawingContext& get_context() { return m_context; }
 
+  /** Collects additive texture requests into one request per
+      texture, so that the lights of a frame take a draw call per
+      light sprite instead of one per light */
+  void set_batch_additive(bool batch) { m_batch_additive = batch; }
+
 private:
   Vector apply_translate(const Vector& pos) const;
 
+  /** Adds the quad to an additive batch and returns true, or returns
+      false if it has to go into a request of its own */
+  bool batch_additive(const SurfacePtr& surface, const Rectf& srcrect, const Rectf& dstrect,
+                      float angle, const Color& color, const Blend& blend, int layer);
+
 private:
   DrawingContext& m_context;
   obstack& m_obst;
   std::vector<DrawingRequest*> m_requests;
+  bool m_has_displacement;
+
+  bool m_batch_additive;
+
+  /** Requests that quads can still be added to, see batch_additive() */
+  std::vector<TextureRequest*> m_additive_batches;
 
 private:
   Canvas(const Canvas&) = delete;
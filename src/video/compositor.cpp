@@ -79,8 +79,17 @@ Compositor::render()
     lightmap.end_draw();
   }
 
+  // The back buffer is only sampled by requests with a displacement
+  // texture, renderers that can grab it from the screen don't need
+  // the extra pass at all
   auto back_renderer = m_video_system.get_back_renderer();
-  if (back_renderer)
+  const bool use_back_renderer = back_renderer && !back_renderer->supports_screen_grab() &&
+    std::any_of(m_drawing_contexts.begin(), m_drawing_contexts.end(),
+                [](std::unique_ptr<DrawingContext>& ctx){
+                  return ctx->color().has_displacement();
+                });
+
+  if (use_back_renderer)
   {
     back_renderer->start_draw();
 
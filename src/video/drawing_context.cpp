@@ -38,6 +38,7 @@ DrawingContext::DrawingContext(VideoSystem& video_system_, obstack& obst, bool o
   m_colormap_canvas(*this, m_obst),
   m_lightmap_canvas(*this, m_obst)
 {
+  m_lightmap_canvas.set_batch_additive(true);
 }
 
 DrawingContext::~DrawingContext()
@@ -63,6 +63,7 @@ struct TextureRequest : public DrawingRequest
     srcrects(),
     dstrects(),
     angles(),
+    colors(),
     color(1.0f, 1.0f, 1.0f)
   {}
 
@@ -71,6 +72,10 @@ struct TextureRequest : public DrawingRequest
   std::vector<Rectf> srcrects;
   std::vector<Rectf> dstrects;
   std::vector<float> angles;
+
+  /** One color per quad, used instead of 'color' when not empty, so
+      differently colored lights can share a request */
+  std::vector<Color> colors;
   Color color;
 
 private:
@@ -19,11 +19,13 @@
 #include "supertux/globals.hpp"
 #include "video/glutil.hpp"
 #include "video/color.hpp"
+#include "video/gl/gl_state.hpp"
 #include "video/gl/gl_texture.hpp"
 
 #ifndef USE_OPENGLES2
 
-GL20Context::GL20Context()
+GL20Context::GL20Context(GLState& state) :
+  m_state(state)
 {
   assert_gl();
 }
@@ -76,7 +78,7 @@ GL20Context::blend_func(GLenum src, GLenum dst)
 {
   assert_gl();
 
-  glBlendFunc(src, dst);
+  m_state.blend_func(src, dst);
 
   assert_gl();
 }
@@ -141,7 +143,7 @@ GL20Context::bind_texture(const Texture& texture, const Texture* displacement_te
   assert_gl();
 
   glEnable(GL_TEXTURE_2D);
-  glBindTexture(GL_TEXTURE_2D, static_cast<const GLTexture&>(texture).get_handle());
+  m_state.bind_texture(0, static_cast<const GLTexture&>(texture).get_handle());
 
   assert_gl();
 
@@ -183,7 +185,7 @@ GL20Context::draw_arrays(GLenum type, GLint first, GLsizei count)
 {
   assert_gl();
 
-  glDrawArrays(type, first, count);
+  m_state.draw_arrays(type, first, count);
 
   assert_gl();
 }
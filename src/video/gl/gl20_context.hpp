@@ -21,10 +21,12 @@
 
 #ifndef USE_OPENGLES2
 
+class GLState;
+
 class GL20Context final : public GLContext
 {
 public:
-  GL20Context();
+  GL20Context(GLState& state);
   ~GL20Context();
 
   virtual std::string get_name() const override { return "opengl20"; }
@@ -50,6 +52,9 @@ public:
 
   virtual bool supports_framebuffer() const override { return false; }
 
+private:
+  GLState& m_state;
+
 private:
   GL20Context(const GL20Context&) = delete;
   GL20Context& operator=(const GL20Context&) = delete;
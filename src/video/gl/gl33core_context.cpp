@@ -19,6 +19,7 @@
 #include "supertux/globals.hpp"
 #include "video/color.hpp"
 #include "video/gl/gl_program.hpp"
+#include "video/gl/gl_state.hpp"
 #include "video/gl/gl_texture.hpp"
 #include "video/gl/gl_texture_renderer.hpp"
 #include "video/gl/gl_vertex_arrays.hpp"
@@ -27,16 +28,30 @@
 
 GL33CoreContext::GL33CoreContext(GLVideoSystem& video_system) :
   m_video_system(video_system),
+  m_state(video_system.get_state()),
   m_program(),
   m_vertex_arrays(),
   m_white_texture(),
   m_black_texture(),
   m_grey_texture(),
-  m_transparent_texture()
+  m_transparent_texture(),
+  m_animate(),
+  m_displacement_animate()
 {
   assert_gl();
 
   m_program.reset(new GLProgram);
+  m_state.use_program(m_program->get_handle());
+
+  // sampler uniforms never change, so they are set once here
+  glUniform1i(m_program->get_diffuse_texture_location(), 0);
+  glUniform1i(m_program->get_displacement_texture_location(), 1);
+  glUniform1i(m_program->get_framebuffer_texture_location(), 2);
+
+  // match the uniform defaults, so the first set_animate() can be skipped
+  glUniform2f(m_program->get_animate_location(), 0.0f, 0.0f);
+  glUniform2f(m_program->get_displacement_animate_location(), 0.0f, 0.0f);
+
   m_vertex_arrays.reset(new GLVertexArrays(*this));
   m_white_texture.reset(new GLTexture(1, 1, Color::WHITE));
   m_black_texture.reset(new GLTexture(1, 1, Color::BLACK));
@@ -59,7 +74,7 @@ GL33CoreContext::bind()
   glDisable(GL_CULL_FACE);
   glEnable(GL_BLEND);
 
-  m_program->bind();
+  m_state.use_program(m_program->get_handle());
   m_vertex_arrays->bind();
 
   GLTextureRenderer* back_renderer = static_cast<GLTextureRenderer*>(m_video_system.get_back_renderer());
@@ -68,16 +83,15 @@ GL33CoreContext::bind()
   if (back_renderer->is_rendering() || !back_renderer->get_texture())
   {
     texture = m_black_texture.get();
-    glUniform1f(m_program->get_uniform_location("backbuffer"), 0.0f);
+    glUniform1f(m_program->get_backbuffer_location(), 0.0f);
   }
   else
   {
     texture = static_cast<GLTexture*>(back_renderer->get_texture().get());
-    glUniform1f(m_program->get_uniform_location("backbuffer"), 1.0f);
+    glUniform1f(m_program->get_backbuffer_location(), 1.0f);
   }
 
-  glActiveTexture(GL_TEXTURE2);
-  glBindTexture(GL_TEXTURE_2D, texture->get_handle());
+  m_state.bind_texture(2, texture->get_handle());
 
   const float tsx =
     static_cast<float>(texture->get_image_width()) /
@@ -99,14 +113,12 @@ GL33CoreContext::bind()
     0.0, sy, 0,
     tx, ty, 1.0,
   };
-  glUniformMatrix3fv(m_program->get_uniform_location("fragcoord2uv"),
+  glUniformMatrix3fv(m_program->get_fragcoord2uv_location(),
                      1, false, matrix);
 
-  glUniform1i(m_program->get_uniform_location("diffuse_texture"), 0);
-  glUniform1i(m_program->get_uniform_location("displacement_texture"), 1);
-  glUniform1i(m_program->get_uniform_location("framebuffer_texture"), 2);
+  glUniform1f(m_program->get_game_time_location(), g_game_time);
 
-  glUniform1f(m_program->get_uniform_location("game_time"), g_game_time);
+  m_state.count_calls(3);
 
   assert_gl();
 }
@@ -128,8 +140,8 @@ GL33CoreContext::ortho(float width, float height, bool vflip)
     0, 0, 1
   };
 
-  const GLint mvp_loc = m_program->get_uniform_location("modelviewprojection");
-  glUniformMatrix3fv(mvp_loc, 1, false, mvp_matrix);
+  glUniformMatrix3fv(m_program->get_modelviewprojection_location(), 1, false, mvp_matrix);
+  m_state.count_calls(1);
 
   assert_gl();
 }
@@ -139,7 +151,7 @@ GL33CoreContext::blend_func(GLenum src, GLenum dst)
 {
   assert_gl();
 
-  glBlendFunc(src, dst);
+  m_state.blend_func(src, dst);
 
   assert_gl();
 }
@@ -183,38 +195,34 @@ GL33CoreContext::bind_texture(const Texture& texture, const Texture* displacemen
 
   if (displacement_texture && back_renderer->is_rendering())
   {
-    glActiveTexture(GL_TEXTURE0);
-    glBindTexture(GL_TEXTURE_2D, m_transparent_texture->get_handle());
+    m_state.bind_texture(0, m_transparent_texture->get_handle());
   }
   else
   {
-    glActiveTexture(GL_TEXTURE0);
-    glBindTexture(GL_TEXTURE_2D, static_cast<const GLTexture&>(texture).get_handle());
+    m_state.bind_texture(0, static_cast<const GLTexture&>(texture).get_handle());
 
     Vector animate = static_cast<const GLTexture&>(texture).get_sampler().get_animate();
 
     animate.x /= static_cast<float>(texture.get_image_width());
     animate.y /= static_cast<float>(texture.get_image_height());
 
-    glUniform2f(m_program->get_uniform_location("animate"), animate.x, animate.y);
+    set_animate(m_program->get_animate_location(), m_animate, animate);
   }
 
   if (displacement_texture)
   {
-    glActiveTexture(GL_TEXTURE1);
-    glBindTexture(GL_TEXTURE_2D, static_cast<const GLTexture&>(*displacement_texture).get_handle());
+    m_state.bind_texture(1, static_cast<const GLTexture&>(*displacement_texture).get_handle());
 
     Vector animate = static_cast<const GLTexture&>(*displacement_texture).get_sampler().get_animate();
 
     animate.x /= static_cast<float>(displacement_texture->get_image_width());
     animate.y /= static_cast<float>(displacement_texture->get_image_height());
 
-    glUniform2f(m_program->get_uniform_location("displacement_animate"), animate.x, animate.y);
+    set_animate(m_program->get_displacement_animate_location(), m_displacement_animate, animate);
   }
   else
   {
-    glActiveTexture(GL_TEXTURE1);
-    glBindTexture(GL_TEXTURE_2D, m_grey_texture->get_handle());
+    m_state.bind_texture(1, m_grey_texture->get_handle());
   }
 
   assert_gl();
@@ -225,11 +233,8 @@ GL33CoreContext::bind_no_texture()
 {
   assert_gl();
 
-  glActiveTexture(GL_TEXTURE0);
-  glBindTexture(GL_TEXTURE_2D, m_white_texture->get_handle());
-
-  glActiveTexture(GL_TEXTURE1);
-  glBindTexture(GL_TEXTURE_2D, m_grey_texture->get_handle());
+  m_state.bind_texture(0, m_white_texture->get_handle());
+  m_state.bind_texture(1, m_grey_texture->get_handle());
 
   assert_gl();
 }
@@ -239,9 +244,23 @@ GL33CoreContext::draw_arrays(GLenum type, GLint first, GLsizei count)
 {
   assert_gl();
 
-  glDrawArrays(type, first, count);
+  m_state.draw_arrays(type, first, count);
 
   assert_gl();
 }
 
+void
+GL33CoreContext::set_animate(GLint loc, Vector& current, const Vector& animate)
+{
+  if (current == animate)
+  {
+    m_state.count_skipped(1);
+    return;
+  }
+
+  glUniform2f(loc, animate.x, animate.y);
+  current = animate;
+  m_state.count_calls(1);
+}
+
 /* EOF */
@@ -21,7 +21,10 @@
 
 #include <memory>
 
+#include "math/vector.hpp"
+
 class GLProgram;
+class GLState;
 class GLTexture;
 class GLVertexArrays;
 class GLVideoSystem;
@@ -54,12 +57,18 @@ public:
 
   virtual bool supports_framebuffer() const override { return true; }
 
+  GLState& get_state() const { return m_state; }
   GLProgram& get_program() const { return *m_program; }
   GLVertexArrays& get_vertex_arrays() const { return *m_vertex_arrays; }
   GLTexture& get_white_texture() const { return *m_white_texture; }
 
+private:
+  /** Sets one of the 'animate' uniforms, unless it already holds the value */
+  void set_animate(GLint loc, Vector& current, const Vector& animate);
+
 private:
   GLVideoSystem& m_video_system;
+  GLState& m_state;
   std::unique_ptr<GLProgram> m_program;
   std::unique_ptr<GLVertexArrays> m_vertex_arrays;
   std::unique_ptr<GLTexture> m_white_texture;
@@ -67,6 +76,11 @@ private:
   std::unique_ptr<GLTexture> m_grey_texture;
   std::unique_ptr<GLTexture> m_transparent_texture;
 
+  /** Last values uploaded to the 'animate' and 'displacement_animate'
+      uniforms */
+  Vector m_animate;
+  Vector m_displacement_animate;
+
 private:
   GL33CoreContext(const GL33CoreContext&) = delete;
   GL33CoreContext& operator=(const GL33CoreContext&) = delete;
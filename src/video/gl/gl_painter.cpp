@@ -30,6 +30,7 @@
 #include "video/gl/gl_vertex_arrays.hpp"
 #include "video/gl/gl_video_system.hpp"
 #include "video/glutil.hpp"
+#include "video/texture_manager.hpp"
 #include "video/video_system.hpp"
 #include "video/viewport.hpp"
 
@@ -70,6 +71,13 @@ GLPainter::draw_texture(const TextureRequest& request)
 {
   assert_gl();
 
+  // reloads the textures if they were unloaded to stay in the budget
+  TextureManager::current()->touch(*request.texture);
+  if (request.displacement_texture)
+  {
+    TextureManager::current()->touch(*request.displacement_texture);
+  }
+
   const auto& texture = static_cast<const GLTexture&>(*request.texture);
 
   assert(request.srcrects.size() == request.dstrects.size());
@@ -158,16 +166,43 @@ GLPainter::draw_texture(const TextureRequest& request)
     }
   }
 
+  if (request.displacement_texture)
+  {
+    m_renderer.prepare_displacement();
+  }
+
   GLContext& context = m_video_system.get_context();
 
   context.blend_func(sfactor(request.blend), dfactor(request.blend));
   context.bind_texture(texture, request.displacement_texture);
   context.set_texcoords(uvs.data(), sizeof(float) * uvs.size());
   context.set_positions(vertices.data(), sizeof(float) * vertices.size());
-  context.set_color(Color(request.color.red,
-                          request.color.green,
-                          request.color.blue,
-                          request.color.alpha * request.alpha));
+
+  std::vector<float> colors;
+  if (request.colors.empty())
+  {
+    context.set_color(Color(request.color.red,
+                            request.color.green,
+                            request.color.blue,
+                            request.color.alpha * request.alpha));
+  }
+  else
+  {
+    assert(request.colors.size() == request.srcrects.size());
+
+    colors.reserve(request.colors.size() * 6 * 4);
+    for (const auto& color : request.colors)
+    {
+      for (int vertex = 0; vertex < 6; ++vertex)
+      {
+        colors.push_back(color.red);
+        colors.push_back(color.green);
+        colors.push_back(color.blue);
+        colors.push_back(color.alpha * request.alpha);
+      }
+    }
+    context.set_colors(colors.data(), sizeof(float) * colors.size());
+  }
 
   context.draw_arrays(GL_TRIANGLES, 0, static_cast<GLsizei>(request.srcrects.size() * 2 * 3));
 
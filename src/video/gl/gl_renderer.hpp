@@ -28,6 +28,9 @@ public:
 
   virtual GLPainter& get_painter() override { return m_painter; }
 
+  /** Called before a request with a displacement texture is drawn */
+  virtual void prepare_displacement() {}
+
 protected:
   GLVideoSystem& m_video_system;
   GLPainter m_painter;
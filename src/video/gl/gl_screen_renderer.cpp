@@ -23,12 +23,14 @@
 #include "util/log.hpp"
 #include "video/gl/gl_context.hpp"
 #include "video/gl/gl_program.hpp"
+#include "video/gl/gl_texture_renderer.hpp"
 #include "video/gl/gl_vertex_arrays.hpp"
 #include "video/gl/gl_video_system.hpp"
 #include "video/glutil.hpp"
 
 GLScreenRenderer::GLScreenRenderer(GLVideoSystem& video_system) :
-  GLRenderer(video_system)
+  GLRenderer(video_system),
+  m_back_buffer_grabbed(false)
 {
 }
 
@@ -41,6 +43,8 @@ GLScreenRenderer::start_draw()
 {
   assert_gl();
 
+  m_back_buffer_grabbed = false;
+
   GLContext& context = m_video_system.get_context();
   context.bind();
 
@@ -67,6 +71,21 @@ GLScreenRenderer::end_draw()
 {
 }
 
+void
+GLScreenRenderer::prepare_displacement()
+{
+  if (m_back_buffer_grabbed)
+    return;
+
+  auto back_renderer = static_cast<GLTextureRenderer*>(m_video_system.get_back_renderer());
+  if (back_renderer && back_renderer->supports_screen_grab())
+  {
+    back_renderer->grab_screen(get_rect());
+  }
+
+  m_back_buffer_grabbed = true;
+}
+
 Rect
 GLScreenRenderer::get_rect() const
 {
@@ -40,6 +40,13 @@ public:
 
   virtual TexturePtr get_texture() const override { return {}; }
 
+  /** Grabs the back buffer from the screen at the first displacement
+      request of a frame */
+  virtual void prepare_displacement() override;
+
+private:
+  bool m_back_buffer_grabbed;
+
 private:
   GLScreenRenderer(const GLScreenRenderer&) = delete;
   GLScreenRenderer& operator=(const GLScreenRenderer&) = delete;
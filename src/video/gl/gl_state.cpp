@@ -0,0 +1,129 @@
+//  SuperTux
+//  Copyright (C) 2020 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "video/gl/gl_state.hpp"
+
+#include <assert.h>
+
+GLState::GLState() :
+  m_program(0),
+  m_vertex_array(0),
+  // initial values as defined by the GL spec
+  m_blend_src(GL_ONE),
+  m_blend_dst(GL_ZERO),
+  m_active_unit(0),
+  m_textures(),
+  m_stats(),
+  m_last_stats()
+{
+  m_textures.fill(0);
+}
+
+void
+GLState::use_program(GLuint program)
+{
+  if (m_program == program) {
+    m_stats.skipped += 1;
+    return;
+  }
+
+  glUseProgram(program);
+  m_program = program;
+  m_stats.calls += 1;
+}
+
+void
+GLState::bind_vertex_array(GLuint vao)
+{
+  if (m_vertex_array == vao) {
+    m_stats.skipped += 1;
+    return;
+  }
+
+  glBindVertexArray(vao);
+  m_vertex_array = vao;
+  m_stats.calls += 1;
+}
+
+void
+GLState::blend_func(GLenum src, GLenum dst)
+{
+  if (m_blend_src == src && m_blend_dst == dst) {
+    m_stats.skipped += 1;
+    return;
+  }
+
+  glBlendFunc(src, dst);
+  m_blend_src = src;
+  m_blend_dst = dst;
+  m_stats.calls += 1;
+}
+
+void
+GLState::bind_texture(int unit, GLuint handle)
+{
+  assert(unit >= 0 && unit < MAX_TEXTURE_UNITS);
+
+  if (m_textures[unit] == handle) {
+    m_stats.skipped += 1;
+    return;
+  }
+
+  if (m_active_unit != unit) {
+    glActiveTexture(static_cast<GLenum>(static_cast<int>(GL_TEXTURE0) + unit));
+    m_active_unit = unit;
+    m_stats.calls += 1;
+  }
+
+  glBindTexture(GL_TEXTURE_2D, handle);
+  m_textures[unit] = handle;
+  m_stats.calls += 1;
+}
+
+void
+GLState::bind_texture(GLuint handle)
+{
+  bind_texture(m_active_unit, handle);
+}
+
+void
+GLState::forget_texture(GLuint handle)
+{
+  // glDeleteTextures() resets the binding of every unit that uses the
+  // texture to 0
+  for (auto& texture : m_textures) {
+    if (texture == handle) {
+      texture = 0;
+    }
+  }
+}
+
+void
+GLState::draw_arrays(GLenum type, GLint first, GLsizei count)
+{
+  glDrawArrays(type, first, count);
+  m_stats.calls += 1;
+  m_stats.draws += 1;
+}
+
+void
+GLState::new_frame()
+{
+  m_last_stats = m_stats;
+  m_stats = Stats();
+}
+
+/* EOF */
@@ -0,0 +1,98 @@
+//  SuperTux
+//  Copyright (C) 2020 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef HEADER_SUPERTUX_VIDEO_GL_GL_STATE_HPP
+#define HEADER_SUPERTUX_VIDEO_GL_GL_STATE_HPP
+
+#include <array>
+
+#include "util/currenton.hpp"
+#include "video/gl.hpp"
+
+/** Shadows the parts of the OpenGL state that change per drawing
+    request (program, vertex array, bound textures and blend func) and
+    drops calls that would not change anything. All code that touches
+    that state has to go through this class, otherwise the shadow gets
+    out of sync with the driver. */
+class GLState final : public Currenton<GLState>
+{
+public:
+  /** Number of driver calls made in a frame */
+  struct Stats
+  {
+    /** Calls that were passed on to the driver */
+    int calls = 0;
+
+    /** Redundant calls that were dropped */
+    int skipped = 0;
+
+    /** glDrawArrays() calls, also included in 'calls' */
+    int draws = 0;
+  };
+
+  /** Texture units used by the renderer */
+  static const int MAX_TEXTURE_UNITS = 4;
+
+public:
+  GLState();
+
+  void use_program(GLuint program);
+  void bind_vertex_array(GLuint vao);
+  void blend_func(GLenum src, GLenum dst);
+
+  /** Binds 'handle' to the given texture unit, the active unit is
+      only switched when the binding actually changes */
+  void bind_texture(int unit, GLuint handle);
+
+  /** Binds 'handle' to whatever unit is active, for uploading or
+      copying texture data */
+  void bind_texture(GLuint handle);
+
+  /** Has to be called before a texture handle is deleted, as GL
+      reuses handle names */
+  void forget_texture(GLuint handle);
+
+  void draw_arrays(GLenum type, GLint first, GLsizei count);
+
+  /** Accounts for calls that are made outside of this class, like
+      uniform and buffer updates */
+  void count_calls(int count) { m_stats.calls += count; }
+  void count_skipped(int count) { m_stats.skipped += count; }
+
+  /** Moves the counters of the current frame to get_last_stats() */
+  void new_frame();
+
+  const Stats& get_last_stats() const { return m_last_stats; }
+
+private:
+  GLuint m_program;
+  GLuint m_vertex_array;
+  GLenum m_blend_src;
+  GLenum m_blend_dst;
+  int m_active_unit;
+  std::array<GLuint, MAX_TEXTURE_UNITS> m_textures;
+
+  Stats m_stats;
+  Stats m_last_stats;
+
+private:
+  GLState(const GLState&) = delete;
+  GLState& operator=(const GLState&) = delete;
+};
+
+#endif
+
+/* EOF */
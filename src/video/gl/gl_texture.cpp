@@ -18,10 +18,118 @@
 
 #include <assert.h>
 
+#include "video/gl/gl_state.hpp"
 #include "video/glutil.hpp"
 #include "video/sampler.hpp"
 #include "video/sdl_surface.hpp"
 
+namespace {
+
+/** Checks if the pixels of the surface can be passed to
+    glTexImage2D() directly and returns the matching format */
+bool get_upload_format(const SDL_Surface& surface, GLenum& format)
+{
+  const SDL_PixelFormat& fmt = *surface.format;
+
+  // create_padded_surface() applies the color key and the color and
+  // alpha modulation when blitting, so such surfaces have to take that
+  // path. The blend mode doesn't matter, it is reset to
+  // SDL_BLENDMODE_NONE there.
+  SDL_Surface* surface_ptr = const_cast<SDL_Surface*>(&surface);
+  Uint32 key;
+  Uint8 r, g, b, a;
+  if (SDL_GetColorKey(surface_ptr, &key) == 0 ||
+      SDL_GetSurfaceColorMod(surface_ptr, &r, &g, &b) != 0 || r != 255 || g != 255 || b != 255 ||
+      SDL_GetSurfaceAlphaMod(surface_ptr, &a) != 0 || a != 255)
+  {
+    return false;
+  }
+
+  if (fmt.BytesPerPixel == 4 &&
+#if SDL_BYTEORDER == SDL_BIG_ENDIAN
+      fmt.Rmask == 0xff000000 && fmt.Gmask == 0x00ff0000 &&
+      fmt.Bmask == 0x0000ff00 && fmt.Amask == 0x000000ff
+#else
+      fmt.Rmask == 0x000000ff && fmt.Gmask == 0x0000ff00 &&
+      fmt.Bmask == 0x00ff0000 && fmt.Amask == 0xff000000
+#endif
+    )
+  {
+    format = GL_RGBA;
+  }
+  else if (fmt.BytesPerPixel == 3 &&
+#if SDL_BYTEORDER == SDL_BIG_ENDIAN
+           fmt.Rmask == 0xff0000 && fmt.Gmask == 0x00ff00 && fmt.Bmask == 0x0000ff
+#else
+           fmt.Rmask == 0x0000ff && fmt.Gmask == 0x00ff00 && fmt.Bmask == 0xff0000
+#endif
+    )
+  {
+    format = GL_RGB;
+  }
+  else
+  {
+    return false;
+  }
+
+  // the row length is given in pixels, so the pitch has to be a
+  // multiple of it
+#if defined(GL_UNPACK_ROW_LENGTH) || defined(USE_GLBINDING)
+  return surface.pitch % fmt.BytesPerPixel == 0;
+#else
+  return surface.pitch == surface.w * fmt.BytesPerPixel;
+#endif
+}
+
+/** Copies the image into the top left of a new RGBA surface of the
+    given size, filling the remaining pixels with repeated copies of
+    the image borders to minimize OpenGL blending artifacts */
+SDLSurfacePtr create_padded_surface(const SDL_Surface& image, int width, int height)
+{
+  SDLSurfacePtr convert = SDLSurface::create_rgba(width, height);
+
+  SDL_SetSurfaceBlendMode(const_cast<SDL_Surface*>(&image), SDL_BLENDMODE_NONE);
+  SDL_BlitSurface(const_cast<SDL_Surface*>(&image), nullptr, convert.get(), nullptr);
+
+  if (SDL_MUSTLOCK(convert)) {
+    SDL_LockSurface(convert.get());
+  }
+
+  if (image.w != width) {
+    SDL_Rect srcrect{image.w - 1, 0, 1, image.h};
+    for (int x = image.w; x < width; ++x) {
+      SDL_Rect dstrect{x, 0, 1, image.h};
+      SDL_BlitSurface(const_cast<SDL_Surface*>(&image), &srcrect, convert.get(), &dstrect);
+    }
+  }
+
+  if (image.h != height) {
+    SDL_Rect srcrect{0, image.h - 1, image.w, 1};
+    for (int y = image.h; y < height; ++y) {
+      SDL_Rect dstrect{0, y, image.w, 1};
+      SDL_BlitSurface(const_cast<SDL_Surface*>(&image), &srcrect, convert.get(), &dstrect);
+    }
+  }
+
+  if (image.w != width && image.h != height)
+  {
+    const int bpp = convert->format->BytesPerPixel;
+    const int x = image.w - 1;
+    const int y = image.h - 1;
+    Uint32 color = *reinterpret_cast<Uint32*>(static_cast<uint8_t*>(convert->pixels) + y * convert->pitch + x * bpp);
+    SDL_Rect dstrect{image.w, image.h, width, height};
+    SDL_FillRect(convert.get(), &dstrect, color);
+  }
+
+  if (SDL_MUSTLOCK(convert)) {
+    SDL_UnlockSurface(convert.get());
+  }
+
+  return convert;
+}
+
+} // namespace
+
 GLTexture::GLTexture(int width, int height, boost::optional<Color> fill_color) :
   m_handle(),
   m_sampler(),
@@ -44,7 +152,7 @@ GLTexture::GLTexture(int width, int height, boost::optional<Color> fill_color) :
   glGenTextures(1, &m_handle);
 
   try {
-    glBindTexture(GL_TEXTURE_2D, m_handle);
+    GLState::current()->bind_texture(m_handle);
 
     if (fill_color)
     {
@@ -60,6 +168,7 @@ GLTexture::GLTexture(int width, int height, boost::optional<Color> fill_color) :
 
     set_texture_params();
   } catch(...) {
+    GLState::current()->forget_texture(m_handle);
     glDeleteTextures(1, &m_handle);
     throw;
   }
@@ -91,82 +200,99 @@ GLTexture::GLTexture(const SDL_Surface& image, const Sampler& sampler) :
   m_image_width  = image.w;
   m_image_height = image.h;
 
-  SDLSurfacePtr convert = SDLSurface::create_rgba(m_texture_width, m_texture_height);
+  upload(image);
+}
 
-  SDL_SetSurfaceBlendMode(const_cast<SDL_Surface*>(&image), SDL_BLENDMODE_NONE);
-  SDL_BlitSurface(const_cast<SDL_Surface*>(&image), nullptr, convert.get(), nullptr);
+GLTexture::~GLTexture()
+{
+  if (m_handle == 0)
+    return;
 
-  // Fill the remaining pixels of 'convert' with repeated copies of
-  // 'image' to minimize OpenGL blending artifacts at the borders
-  if (m_image_width != m_texture_width || m_image_height != m_texture_height)
-  {
-    if (SDL_MUSTLOCK(convert)) {
-      SDL_LockSurface(convert.get());
-    }
+  if (auto state = GLState::current()) {
+    state->forget_texture(m_handle);
+  }
+  glDeleteTextures(1, &m_handle);
+}
 
-    if (m_image_width != m_texture_width) {
-      SDL_Rect srcrect{m_image_width - 1, 0, 1, m_image_height};
-      for (int x = m_image_width; x < m_texture_width; ++x) {
-        SDL_Rect dstrect{x, 0, 1, m_image_height};
-        SDL_BlitSurface(const_cast<SDL_Surface*>(&image), &srcrect, convert.get(), &dstrect);
-      }
-    }
+bool
+GLTexture::unload()
+{
+  if (m_handle == 0)
+    return true;
 
-    if (m_image_height != m_texture_height) {
-      SDL_Rect srcrect{0, m_image_height - 1, m_image_width, 1};
-      for (int y = m_image_height; y < m_texture_height; ++y) {
-        SDL_Rect dstrect{0, y, m_image_width, 1};
-        SDL_BlitSurface(const_cast<SDL_Surface*>(&image), &srcrect, convert.get(), &dstrect);
-      }
-    }
+  GLState::current()->forget_texture(m_handle);
+  glDeleteTextures(1, &m_handle);
+  m_handle = 0;
+  return true;
+}
 
-    if (m_image_width != m_texture_width && m_image_height != m_texture_height)
-    {
-      const int bpp = convert->format->BytesPerPixel;
-      const int x = m_image_width - 1;
-      const int y = m_image_height - 1;
-      Uint32 color = *reinterpret_cast<Uint32*>(static_cast<uint8_t*>(convert->pixels) + y * convert->pitch + x * bpp);
-      SDL_Rect dstrect{m_image_width, m_image_height, m_texture_width, m_texture_height};
-      SDL_FillRect(convert.get(), &dstrect, color);
-    }
+void
+GLTexture::reload(const SDL_Surface& image)
+{
+  assert(m_handle == 0);
+  assert(image.w == m_image_width && image.h == m_image_height);
 
-    if (SDL_MUSTLOCK(convert)) {
-      SDL_UnlockSurface(convert.get());
-    }
-  }
+  upload(image);
+}
 
+bool
+GLTexture::supports_repeat() const
+{
+  // a padded texture would repeat the padding as well
+  return m_sampler.get_wrap_s() == GL_REPEAT &&
+         m_sampler.get_wrap_t() == GL_REPEAT &&
+         m_texture_width == m_image_width &&
+         m_texture_height == m_image_height;
+}
+
+void
+GLTexture::upload(const SDL_Surface& image)
+{
   assert_gl();
 
+  // Upload the decoded surface as is whenever possible, only padding,
+  // an unsupported pixel format or blit settings like a color key
+  // require a copy
+  SDLSurfacePtr convert;
+  GLenum sdl_format;
+  if (m_image_width != m_texture_width || m_image_height != m_texture_height ||
+      !get_upload_format(image, sdl_format))
+  {
+    convert = create_padded_surface(image, m_texture_width, m_texture_height);
+    sdl_format = GL_RGBA;
+  }
+
+  const SDL_Surface& surface = convert ? *convert : image;
+
   glGenTextures(1, &m_handle);
 
   try {
-    GLenum sdl_format;
-    if (convert->format->BytesPerPixel == 3) {
-      sdl_format = GL_RGB;
-    } else if (convert->format->BytesPerPixel == 4) {
-      sdl_format = GL_RGBA;
-    } else {
-      sdl_format = GL_RGBA; // NOLINT
-      assert(false);
-    }
+    GLState::current()->bind_texture(m_handle);
 
-    glBindTexture(GL_TEXTURE_2D, m_handle);
     glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
 #if defined(GL_UNPACK_ROW_LENGTH) || defined(USE_GLBINDING)
-    glPixelStorei(GL_UNPACK_ROW_LENGTH, convert->pitch/convert->format->BytesPerPixel);
+    glPixelStorei(GL_UNPACK_ROW_LENGTH, surface.pitch / surface.format->BytesPerPixel);
 #else
-    /* OpenGL ES doesn't support UNPACK_ROW_LENGTH, let's hope SDL didn't add
-     * padding bytes, otherwise we need some extra code here... */
-    assert(convert->pitch == static_cast<int>(m_texture_width * convert->format->BytesPerPixel));
+    /* OpenGL ES doesn't support UNPACK_ROW_LENGTH, get_upload_format()
+     * makes sure the rows aren't padded */
+    assert(surface.pitch == surface.w * surface.format->BytesPerPixel);
 #endif
 
-    if (SDL_MUSTLOCK(convert)) {
-      SDL_LockSurface(convert.get());
+    if (SDL_MUSTLOCK(&surface)) {
+      SDL_LockSurface(const_cast<SDL_Surface*>(&surface));
     }
 
     glTexImage2D(GL_TEXTURE_2D, 0, static_cast<GLint>(GL_RGBA),
                  m_texture_width, m_texture_height, 0, sdl_format,
-                 GL_UNSIGNED_BYTE, convert->pixels);
+                 GL_UNSIGNED_BYTE, surface.pixels);
+
+    if (SDL_MUSTLOCK(&surface)) {
+      SDL_UnlockSurface(const_cast<SDL_Surface*>(&surface));
+    }
+
+#if defined(GL_UNPACK_ROW_LENGTH) || defined(USE_GLBINDING)
+    glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+#endif
 
     // no not use mipmaps
     if ((false))
@@ -174,26 +300,19 @@ GLTexture::GLTexture(const SDL_Surface& image, const Sampler& sampler) :
       glGenerateMipmap(GL_TEXTURE_2D);
     }
 
-    if (SDL_MUSTLOCK(convert.get())) {
-      SDL_UnlockSurface(convert.get());
-    }
-
     assert_gl();
 
     set_texture_params();
   } catch(...) {
+    GLState::current()->forget_texture(m_handle);
     glDeleteTextures(1, &m_handle);
+    m_handle = 0;
     throw;
   }
 
   assert_gl();
 }
 
-GLTexture::~GLTexture()
-{
-  glDeleteTextures(1, &m_handle);
-}
-
 void
 GLTexture::set_texture_params()
 {
@@ -42,6 +42,10 @@ public:
   virtual int get_image_width() const override { return m_image_width; }
   virtual int get_image_height() const override { return m_image_height; }
 
+  virtual bool unload() override;
+  virtual void reload(const SDL_Surface& image) override;
+  virtual bool supports_repeat() const override;
+
   void set_handle(GLuint handle) { m_handle = handle; }
   const GLuint &get_handle() const { return m_handle; }
 
@@ -51,6 +55,7 @@ public:
   void set_image_height(int height) { m_image_height = height; }
 
 private:
+  void upload(const SDL_Surface& image);
   void set_texture_params();
 
 private:
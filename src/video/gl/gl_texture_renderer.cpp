@@ -25,6 +25,7 @@
 #include "video/gl/gl_framebuffer.hpp"
 #include "video/gl/gl_painter.hpp"
 #include "video/gl/gl_program.hpp"
+#include "video/gl/gl_state.hpp"
 #include "video/gl/gl_texture.hpp"
 #include "video/gl/gl_vertex_arrays.hpp"
 #include "video/gl/gl_video_system.hpp"
@@ -65,6 +66,47 @@ GLTextureRenderer::is_rendering() const
   return m_rendering;
 }
 
+bool
+GLTextureRenderer::supports_screen_grab() const
+{
+#ifdef USE_OPENGLES2
+  // glBlitFramebuffer() requires GLES3
+  return false;
+#else
+  return m_video_system.get_context().supports_framebuffer();
+#endif
+}
+
+void
+GLTextureRenderer::grab_screen(const Rect& rect)
+{
+#ifndef USE_OPENGLES2
+  assert(!m_rendering);
+  assert_gl();
+
+  prepare();
+
+  // the blit is subject to the clip rect
+  const bool scissor = glIsEnabled(GL_SCISSOR_TEST) == GL_TRUE;
+  glDisable(GL_SCISSOR_TEST);
+
+  // The screen has its origin at the bottom, while the texture is
+  // rendered with the origin at the top, so the blit flips it
+  glBindFramebuffer(GL_DRAW_FRAMEBUFFER, m_framebuffer->get_handle());
+  glBlitFramebuffer(rect.left, rect.top, rect.right, rect.bottom,
+                    0, m_texture->get_image_height(), m_texture->get_image_width(), 0,
+                    GL_COLOR_BUFFER_BIT, GL_LINEAR);
+  glBindFramebuffer(GL_DRAW_FRAMEBUFFER, 0);
+
+  if (scissor)
+  {
+    glEnable(GL_SCISSOR_TEST);
+  }
+
+  assert_gl();
+#endif
+}
+
 void
 GLTextureRenderer::start_draw()
 {
@@ -106,7 +148,7 @@ GLTextureRenderer::end_draw()
   else
   {
     assert_gl();
-    glBindTexture(GL_TEXTURE_2D, static_cast<GLTexture&>(*m_texture).get_handle());
+    m_video_system.get_state().bind_texture(static_cast<GLTexture&>(*m_texture).get_handle());
     glCopyTexSubImage2D(GL_TEXTURE_2D,
                         0, // level
                         0, 0, // offset
@@ -44,6 +44,11 @@ public:
   virtual Size get_logical_size() const override;
 
   virtual TexturePtr get_texture() const override { return m_texture; }
+  virtual bool supports_screen_grab() const override;
+
+  /** Copies 'rect' of the screen into the texture, scaling it to the
+      texture size */
+  void grab_screen(const Rect& rect);
 
   bool is_rendering() const;
 
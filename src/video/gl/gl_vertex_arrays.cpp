@@ -19,6 +19,7 @@
 #include "video/color.hpp"
 #include "video/gl/gl33core_context.hpp"
 #include "video/gl/gl_program.hpp"
+#include "video/gl/gl_state.hpp"
 #include "video/gl/gl_video_system.hpp"
 #include "video/glutil.hpp"
 
@@ -27,7 +28,10 @@ GLVertexArrays::GLVertexArrays(GL33CoreContext& context) :
   m_vao(),
   m_positions_buffer(),
   m_texcoords_buffer(),
-  m_color_buffer()
+  m_color_buffer(),
+  m_array_buffer(0),
+  m_texcoords_enabled(false),
+  m_colors_enabled(false)
 {
   assert_gl();
 
@@ -36,6 +40,22 @@ GLVertexArrays::GLVertexArrays(GL33CoreContext& context) :
   glGenBuffers(1, &m_texcoords_buffer);
   glGenBuffers(1, &m_color_buffer);
 
+  // Each attribute always reads from its own buffer, so the pointers
+  // only have to be set up once, uploads just replace the data
+  bind();
+
+  const GLProgram& program = m_context.get_program();
+
+  bind_buffer(m_positions_buffer);
+  glVertexAttribPointer(program.get_position_location(), 2, GL_FLOAT, GL_FALSE, 0, nullptr);
+  glEnableVertexAttribArray(program.get_position_location());
+
+  bind_buffer(m_texcoords_buffer);
+  glVertexAttribPointer(program.get_texcoord_location(), 2, GL_FLOAT, GL_FALSE, 0, nullptr);
+
+  bind_buffer(m_color_buffer);
+  glVertexAttribPointer(program.get_diffuse_location(), 4, GL_FLOAT, GL_FALSE, 0, nullptr);
+
   assert_gl();
 }
 
@@ -52,7 +72,7 @@ GLVertexArrays::bind()
 {
   assert_gl();
 
-  glBindVertexArray(m_vao);
+  m_context.get_state().bind_vertex_array(m_vao);
 
   assert_gl();
 }
@@ -62,12 +82,9 @@ GLVertexArrays::set_positions(const float* data, size_t size)
 {
   assert_gl();
 
-  glBindBuffer(GL_ARRAY_BUFFER, m_positions_buffer);
+  bind_buffer(m_positions_buffer);
   glBufferData(GL_ARRAY_BUFFER, size, data, GL_DYNAMIC_DRAW);
-
-  int loc = m_context.get_program().get_attrib_location("position");
-  glVertexAttribPointer(loc, 2, GL_FLOAT, GL_FALSE, 0, nullptr);
-  glEnableVertexAttribArray(loc);
+  m_context.get_state().count_calls(1);
 
   assert_gl();
 }
@@ -77,12 +94,11 @@ GLVertexArrays::set_texcoords(const float* data, size_t size)
 {
   assert_gl();
 
-  glBindBuffer(GL_ARRAY_BUFFER, m_texcoords_buffer);
+  bind_buffer(m_texcoords_buffer);
   glBufferData(GL_ARRAY_BUFFER, size, data, GL_DYNAMIC_DRAW);
+  m_context.get_state().count_calls(1);
 
-  int loc = m_context.get_program().get_attrib_location("texcoord");
-  glVertexAttribPointer(loc, 2, GL_FLOAT, GL_FALSE, 0, nullptr);
-  glEnableVertexAttribArray(loc);
+  set_attrib_array_enabled(m_context.get_program().get_texcoord_location(), m_texcoords_enabled, true);
 
   assert_gl();
 }
@@ -92,9 +108,11 @@ GLVertexArrays::set_texcoord(float u, float v)
 {
   assert_gl();
 
-  int loc = m_context.get_program().get_attrib_location("texcoord");
+  const GLint loc = m_context.get_program().get_texcoord_location();
   glVertexAttrib2f(loc, u, v);
-  glDisableVertexAttribArray(loc);
+  m_context.get_state().count_calls(1);
+
+  set_attrib_array_enabled(loc, m_texcoords_enabled, false);
 
   assert_gl();
 }
@@ -104,12 +122,11 @@ GLVertexArrays::set_colors(const float* data, size_t size)
 {
   assert_gl();
 
-  glBindBuffer(GL_ARRAY_BUFFER, m_texcoords_buffer);
+  bind_buffer(m_color_buffer);
   glBufferData(GL_ARRAY_BUFFER, size, data, GL_DYNAMIC_DRAW);
+  m_context.get_state().count_calls(1);
 
-  int loc = m_context.get_program().get_attrib_location("diffuse");
-  glVertexAttribPointer(loc, 4, GL_FLOAT, GL_FALSE, 0, nullptr);
-  glEnableVertexAttribArray(loc);
+  set_attrib_array_enabled(m_context.get_program().get_diffuse_location(), m_colors_enabled, true);
 
   assert_gl();
 }
@@ -119,11 +136,43 @@ GLVertexArrays::set_color(const Color& color)
 {
   assert_gl();
 
-  int loc = m_context.get_program().get_attrib_location("diffuse");
+  const GLint loc = m_context.get_program().get_diffuse_location();
   glVertexAttrib4f(loc, color.red, color.green, color.blue, color.alpha);
-  glDisableVertexAttribArray(loc);
+  m_context.get_state().count_calls(1);
+
+  set_attrib_array_enabled(loc, m_colors_enabled, false);
 
   assert_gl();
 }
 
+void
+GLVertexArrays::bind_buffer(GLuint buffer)
+{
+  if (m_array_buffer == buffer) {
+    m_context.get_state().count_skipped(1);
+    return;
+  }
+
+  glBindBuffer(GL_ARRAY_BUFFER, buffer);
+  m_array_buffer = buffer;
+  m_context.get_state().count_calls(1);
+}
+
+void
+GLVertexArrays::set_attrib_array_enabled(GLint loc, bool& enabled, bool value)
+{
+  if (enabled == value) {
+    m_context.get_state().count_skipped(1);
+    return;
+  }
+
+  if (value) {
+    glEnableVertexAttribArray(loc);
+  } else {
+    glDisableVertexAttribArray(loc);
+  }
+  enabled = value;
+  m_context.get_state().count_calls(1);
+}
+
 /* EOF */
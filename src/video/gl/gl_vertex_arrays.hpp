@@ -41,6 +41,10 @@ public:
   void set_colors(const float* data, size_t size);
   void set_color(const Color& color);
 
+private:
+  void bind_buffer(GLuint buffer);
+  void set_attrib_array_enabled(GLint loc, bool& enabled, bool value);
+
 private:
   GL33CoreContext& m_context;
   GLuint m_vao;
@@ -48,6 +52,12 @@ private:
   GLuint m_texcoords_buffer;
   GLuint m_color_buffer;
 
+  /** Shadow of GL_ARRAY_BUFFER_BINDING and of the vertex attribute
+      arrays that get toggled between per-vertex and constant values */
+  GLuint m_array_buffer;
+  bool m_texcoords_enabled;
+  bool m_colors_enabled;
+
 private:
   GLVertexArrays(const GLVertexArrays&) = delete;
   GLVertexArrays& operator=(const GLVertexArrays&) = delete;
@@ -24,6 +24,7 @@
 #include "video/gl/gl33core_context.hpp"
 #include "video/gl/gl_context.hpp"
 #include "video/gl/gl_program.hpp"
+#include "video/gl/gl_state.hpp"
 #include "video/gl/gl_screen_renderer.hpp"
 #include "video/gl/gl_texture.hpp"
 #include "video/gl/gl_texture_renderer.hpp"
@@ -42,6 +43,7 @@
 
 GLVideoSystem::GLVideoSystem(bool use_opengl33core) :
   m_use_opengl33core(use_opengl33core),
+  m_state(new GLState),
   m_texture_manager(),
   m_renderer(),
   m_lightmap(),
@@ -58,7 +60,7 @@ GLVideoSystem::GLVideoSystem(bool use_opengl33core) :
   m_context.reset(new GL33CoreContext(*this));
   m_use_opengl33core = true;
 #elif defined(USE_OPENGLES1)
-  m_context.reset(new GL20Context);
+  m_context.reset(new GL20Context(*m_state));
   m_use_opengl33core = false;
 #else
   if (use_opengl33core)
@@ -67,7 +69,7 @@ GLVideoSystem::GLVideoSystem(bool use_opengl33core) :
   }
   else
   {
-    m_context.reset(new GL20Context);
+    m_context.reset(new GL20Context(*m_state));
   }
 #endif
 
@@ -255,6 +257,8 @@ GLVideoSystem::apply_config()
 
   m_viewport = Viewport::from_size(target_size, m_desktop_size);
 
+  m_texture_manager->set_texture_budget(static_cast<size_t>(g_config->texture_budget) * 1024 * 1024);
+
   m_lightmap.reset(new GLTextureRenderer(*this, m_viewport.get_screen_size(), 5));
   if (m_use_opengl33core)
   {
@@ -291,6 +295,8 @@ GLVideoSystem::flip()
 {
   assert_gl();
   SDL_GL_SwapWindow(m_sdl_window.get());
+  m_state->new_frame();
+  m_texture_manager->new_frame();
 }
 
 void
@@ -28,6 +28,7 @@ class GLContext;
 class GLLightmap;
 class GLProgram;
 class GLScreenRenderer;
+class GLState;
 class GLTexture;
 class GLTextureRenderer;
 class GLVertexArrays;
@@ -59,6 +60,7 @@ public:
   virtual SDLSurfacePtr make_screenshot() override;
 
   GLContext& get_context() const { return *m_context; }
+  GLState& get_state() const { return *m_state; }
 
 private:
   void create_gl_window();
@@ -66,6 +68,9 @@ private:
 
 private:
   bool m_use_opengl33core;
+
+  /** Declared first, so it outlives all textures */
+  std::unique_ptr<GLState> m_state;
   std::unique_ptr<TextureManager> m_texture_manager;
   std::unique_ptr<GLScreenRenderer> m_renderer;
   std::unique_ptr<GLTextureRenderer> m_lightmap;
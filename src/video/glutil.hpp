@@ -24,6 +24,7 @@
 
 #ifdef USE_GLBINDING
 #  include <glbinding/ContextInfo.h>
+#  include <glbinding/Version.h>
 #  include <glbinding/gl/extension.h>
 #endif
 
@@ -81,11 +82,14 @@ inline bool gl_needs_power_of_two()
 #elif defined(USE_OPENGLES1)
   return true;
 #else
+  // NPOT textures are core since OpenGL 2.0, but older hardware only
+  // emulates them, so below 3.0 rely on the extension
 #  ifdef USE_GLBINDING
   static auto extensions = glbinding::ContextInfo::extensions();
-  return extensions.find(GLextension::GL_ARB_texture_non_power_of_two) == extensions.end();
+  return glbinding::ContextInfo::version() < glbinding::Version(3, 0) &&
+    extensions.find(GLextension::GL_ARB_texture_non_power_of_two) == extensions.end();
 #  else
-  return !GLEW_ARB_texture_non_power_of_two;
+  return !GLEW_VERSION_3_0 && !GLEW_ARB_texture_non_power_of_two;
 #  endif
 #endif
 }
@@ -41,6 +41,10 @@ public:
   virtual Size get_logical_size() const = 0;
 
   virtual TexturePtr get_texture() const = 0;
+
+  /** Returns true if the texture gets filled by copying from the
+      screen on demand, so the renderer doesn't need a pass of its own */
+  virtual bool supports_screen_grab() const { return false; }
 };
 
 #endif
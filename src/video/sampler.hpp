@@ -17,6 +17,8 @@
 #ifndef HEADER_SUPERTUX_VIDEO_SAMPLER_HPP
 #define HEADER_SUPERTUX_VIDEO_SAMPLER_HPP
 
+#include <tuple>
+
 #include "math/vector.hpp"
 #include "video/gl.hpp"
 
@@ -34,6 +36,11 @@ public:
   GLenum get_wrap_t() const { return m_wrap_t; }
   Vector get_animate() const { return m_animate; }
 
+  bool operator<(const Sampler& other) const {
+    return std::tie(m_filter, m_wrap_s, m_wrap_t, m_animate.x, m_animate.y) <
+      std::tie(other.m_filter, other.m_wrap_s, other.m_wrap_t, other.m_animate.x, other.m_animate.y);
+  }
+
 private:
   GLenum m_filter;
   GLenum m_wrap_s;
@@ -19,7 +19,11 @@
 #include "video/texture_manager.hpp"
 
 Texture::Texture() :
-  m_cache_key()
+  m_cache_key(),
+  m_lru_pos(),
+  m_memory_usage(0),
+  m_last_used_frame(0),
+  m_unloaded(false)
 {
 }
 
@@ -29,6 +33,7 @@ Texture::~Texture()
   {
     // The cache entry is now useless: its weak pointer to us has
     // been cleared. Remove the entry altogether to save memory.
+    TextureManager::current()->untrack(*this);
     TextureManager::current()->reap_cache_entry(*m_cache_key);
   }
 }
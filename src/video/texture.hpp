@@ -17,12 +17,16 @@
 #ifndef HEADER_SUPERTUX_VIDEO_TEXTURE_HPP
 #define HEADER_SUPERTUX_VIDEO_TEXTURE_HPP
 
+#include <list>
 #include <string>
 #include <tuple>
 #include <boost/optional.hpp>
 
 #include "math/rect.hpp"
 #include "video/flip.hpp"
+#include "video/sampler.hpp"
+
+struct SDL_Surface;
 
 /** This class is a wrapper around a texture handle. It stores the
     texture width and height and provides convenience functions for
@@ -32,8 +36,9 @@ class Texture
   friend class TextureManager;
 
 public:
-  /** filename, left, top, right, bottom */
-  using Key = std::tuple<std::string, Rect>;
+  /** filename, rect and sampler, a texture is only shared with users
+      that sample it the same way */
+  using Key = std::tuple<std::string, Rect, Sampler>;
 
 protected:
   Texture();
@@ -47,9 +52,29 @@ public:
   virtual int get_image_width() const = 0;
   virtual int get_image_height() const = 0;
 
+  /** Releases the pixel data on the GPU, the TextureManager reloads
+      it the next time the texture is used. Returns false if the
+      texture doesn't support this. */
+  virtual bool unload() { return false; }
+
+  /** Uploads the pixel data again after unload(), the image has the
+      same size as the original one */
+  virtual void reload(const SDL_Surface& /*image*/) {}
+
+  /** Returns true if texture coordinates outside of the image wrap
+      around, so that a single quad can tile the whole image */
+  virtual bool supports_repeat() const { return false; }
+
 private:
   boost::optional<Key> m_cache_key;
 
+  /** Bookkeeping of the TextureManager memory budget, only used for
+      textures with a cache key */
+  std::list<Texture*>::iterator m_lru_pos;
+  size_t m_memory_usage;
+  int m_last_used_frame;
+  bool m_unloaded;
+
 private:
   Texture(const Texture&) = delete;
   Texture& operator=(const Texture&) = delete;
@@ -0,0 +1,276 @@
+//  SuperTux
+//  Copyright (C) 2020 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "video/texture_cache.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <physfs.h>
+#include <string.h>
+#include <vector>
+
+#include "addon/md5.hpp"
+#include "util/log.hpp"
+#include "util/string_util.hpp"
+#include "video/sdl_surface.hpp"
+
+namespace {
+
+/** Entries are only read back on the machine that wrote them, so the
+    header is stored in native byte order */
+struct EntryHeader
+{
+  char magic[4];
+  uint32_t version;
+  uint32_t width;
+  uint32_t height;
+};
+
+const char ENTRY_MAGIC[4] = { 'S', 'T', 'T', 'C' };
+
+// same layout as SDLSurface::create_rgba()
+#if SDL_BYTEORDER == SDL_BIG_ENDIAN
+const Uint32 ENTRY_FORMAT = SDL_PIXELFORMAT_RGBA8888;
+#else
+const Uint32 ENTRY_FORMAT = SDL_PIXELFORMAT_ABGR8888;
+#endif
+
+using PhysfsFilePtr = std::unique_ptr<PHYSFS_File, int(*)(PHYSFS_File*)>;
+
+bool read_rows(PHYSFS_File* file, SDL_Surface& surface)
+{
+  const PHYSFS_uint64 row_length = static_cast<PHYSFS_uint64>(surface.w) * 4;
+  uint8_t* pixels = static_cast<uint8_t*>(surface.pixels);
+
+  if (surface.pitch == surface.w * 4)
+  {
+    const PHYSFS_uint64 length = row_length * static_cast<PHYSFS_uint64>(surface.h);
+    return PHYSFS_readBytes(file, pixels, length) == static_cast<PHYSFS_sint64>(length);
+  }
+
+  for (int y = 0; y < surface.h; ++y)
+  {
+    if (PHYSFS_readBytes(file, pixels + y * surface.pitch, row_length) != static_cast<PHYSFS_sint64>(row_length))
+      return false;
+  }
+  return true;
+}
+
+bool write_rows(PHYSFS_File* file, const SDL_Surface& surface)
+{
+  const PHYSFS_uint64 row_length = static_cast<PHYSFS_uint64>(surface.w) * 4;
+  const uint8_t* pixels = static_cast<const uint8_t*>(surface.pixels);
+
+  for (int y = 0; y < surface.h; ++y)
+  {
+    if (PHYSFS_writeBytes(file, pixels + y * surface.pitch, row_length) != static_cast<PHYSFS_sint64>(row_length))
+      return false;
+  }
+  return true;
+}
+
+} // namespace
+
+TextureCache::TextureCache(const std::string& directory) :
+  m_directory(directory),
+  m_directory_created(false),
+  m_used_entries()
+{
+}
+
+TextureCache::~TextureCache()
+{
+  prune();
+}
+
+std::string
+TextureCache::get_entry(const std::string& filename) const
+{
+  PhysfsFilePtr file(PHYSFS_openRead(filename.c_str()), PHYSFS_close);
+  if (!file)
+    return std::string();
+
+  MD5 md5;
+  while (true)
+  {
+    unsigned char buffer[16 * 1024];
+    PHYSFS_sint64 len = PHYSFS_readBytes(file.get(), buffer, sizeof(buffer));
+    if (len <= 0) break;
+    md5.update(buffer, static_cast<unsigned int>(len));
+  }
+
+  return m_directory + "/" + md5.hex_digest() + ".rgba";
+}
+
+SDLSurfacePtr
+TextureCache::load(const std::string& entry) const
+{
+  if (entry.empty() || !PHYSFS_exists(entry.c_str()))
+    return SDLSurfacePtr();
+
+  PhysfsFilePtr file(PHYSFS_openRead(entry.c_str()), PHYSFS_close);
+  if (!file)
+    return SDLSurfacePtr();
+
+  EntryHeader header;
+  if (PHYSFS_readBytes(file.get(), &header, sizeof(header)) != static_cast<PHYSFS_sint64>(sizeof(header)) ||
+      memcmp(header.magic, ENTRY_MAGIC, sizeof(ENTRY_MAGIC)) != 0 ||
+      header.version != VERSION ||
+      header.width == 0 || header.width > 16384 ||
+      header.height == 0 || header.height > 16384)
+  {
+    log_debug << "ignoring invalid texture cache entry: " << entry << std::endl;
+    return SDLSurfacePtr();
+  }
+
+  // entries that were cut short while writing are ignored too
+  const PHYSFS_sint64 expected_length = static_cast<PHYSFS_sint64>(sizeof(header)) +
+    static_cast<PHYSFS_sint64>(header.width) * static_cast<PHYSFS_sint64>(header.height) * 4;
+  if (PHYSFS_fileLength(file.get()) != expected_length)
+  {
+    log_debug << "ignoring truncated texture cache entry: " << entry << std::endl;
+    return SDLSurfacePtr();
+  }
+
+  SDLSurfacePtr surface = SDLSurface::create_rgba(static_cast<int>(header.width),
+                                                  static_cast<int>(header.height));
+  if (!read_rows(file.get(), *surface))
+  {
+    log_warning << "couldn't read texture cache entry " << entry << ": " << PHYSFS_getLastErrorCode() << std::endl;
+    return SDLSurfacePtr();
+  }
+
+  m_used_entries.insert(entry);
+  return surface;
+}
+
+void
+TextureCache::store(const std::string& entry, const SDL_Surface& image)
+{
+  if (entry.empty())
+    return;
+
+  if (!m_directory_created)
+  {
+    if (!PHYSFS_exists(m_directory.c_str()) && !PHYSFS_mkdir(m_directory.c_str()))
+    {
+      log_warning << "couldn't create texture cache directory '" << m_directory << "': "
+                  << PHYSFS_getLastErrorCode() << std::endl;
+      return;
+    }
+    m_directory_created = true;
+  }
+
+  SDLSurfacePtr convert;
+  if (image.format->format != ENTRY_FORMAT)
+  {
+    convert.reset(SDL_ConvertSurfaceFormat(const_cast<SDL_Surface*>(&image), ENTRY_FORMAT, 0));
+    if (!convert)
+    {
+      log_warning << "couldn't convert image for the texture cache: " << SDL_GetError() << std::endl;
+      return;
+    }
+  }
+  const SDL_Surface& surface = convert ? *convert : image;
+
+  PhysfsFilePtr file(PHYSFS_openWrite(entry.c_str()), PHYSFS_close);
+  if (!file)
+  {
+    log_warning << "couldn't write texture cache entry " << entry << ": " << PHYSFS_getLastErrorCode() << std::endl;
+    return;
+  }
+
+  EntryHeader header;
+  memcpy(header.magic, ENTRY_MAGIC, sizeof(ENTRY_MAGIC));
+  header.version = VERSION;
+  header.width = static_cast<uint32_t>(surface.w);
+  header.height = static_cast<uint32_t>(surface.h);
+
+  if (PHYSFS_writeBytes(file.get(), &header, sizeof(header)) != static_cast<PHYSFS_sint64>(sizeof(header)) ||
+      !write_rows(file.get(), surface))
+  {
+    log_warning << "couldn't write texture cache entry " << entry << ": " << PHYSFS_getLastErrorCode() << std::endl;
+    return;
+  }
+
+  m_used_entries.insert(entry);
+}
+
+void
+TextureCache::prune()
+{
+  struct Entry
+  {
+    std::string filename;
+    PHYSFS_sint64 size;
+    PHYSFS_sint64 modtime;
+  };
+
+  std::vector<Entry> unused_entries;
+  PHYSFS_sint64 total_size = 0;
+
+  std::unique_ptr<char*, decltype(&PHYSFS_freeList)>
+    files(PHYSFS_enumerateFiles(m_directory.c_str()),
+          PHYSFS_freeList);
+  if (!files)
+    return;
+
+  for (char** i = files.get(); *i != nullptr; ++i)
+  {
+    if (!StringUtil::has_suffix(*i, ".rgba"))
+      continue;
+
+    const std::string filename = m_directory + "/" + *i;
+    PHYSFS_Stat statbuf;
+    if (!PHYSFS_stat(filename.c_str(), &statbuf))
+      continue;
+
+    total_size += statbuf.filesize;
+    if (m_used_entries.find(filename) == m_used_entries.end())
+    {
+      unused_entries.push_back({ filename, statbuf.filesize, statbuf.modtime });
+    }
+  }
+
+  if (total_size <= MAX_SIZE)
+    return;
+
+  std::sort(unused_entries.begin(), unused_entries.end(),
+            [](const Entry& lhs, const Entry& rhs) {
+              return lhs.modtime < rhs.modtime;
+            });
+
+  int deleted = 0;
+  for (const auto& entry : unused_entries)
+  {
+    if (total_size <= MAX_SIZE)
+      break;
+
+    if (!PHYSFS_delete(entry.filename.c_str()))
+    {
+      log_warning << "couldn't delete texture cache entry " << entry.filename << ": "
+                  << PHYSFS_getLastErrorCode() << std::endl;
+      continue;
+    }
+
+    total_size -= entry.size;
+    deleted += 1;
+  }
+
+  log_info << "pruned " << deleted << " texture cache entries" << std::endl;
+}
+
+/* EOF */
@@ -0,0 +1,74 @@
+//  SuperTux
+//  Copyright (C) 2020 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef HEADER_SUPERTUX_VIDEO_TEXTURE_CACHE_HPP
+#define HEADER_SUPERTUX_VIDEO_TEXTURE_CACHE_HPP
+
+#include <set>
+#include <stdint.h>
+#include <string>
+
+#include "video/sdl_surface_ptr.hpp"
+
+/** Stores decoded images as raw RGBA in the user directory, so that
+    the next start can skip decoding the PNG files. Entries are named
+    after the MD5 sum of the source file, changed files thus get a new
+    entry and never return stale pixels. The old entries are pruned
+    once the cache grows beyond MAX_SIZE. */
+class TextureCache final
+{
+public:
+  /** Bumped whenever the format of the entries changes */
+  static const uint32_t VERSION = 1;
+
+  /** Size of all entries in bytes above which prune() deletes some */
+  static const int64_t MAX_SIZE = 256 * 1024 * 1024;
+
+public:
+  TextureCache(const std::string& directory);
+  ~TextureCache();
+
+  /** Returns the name of the cache entry for the image 'filename',
+      or an empty string if it can't be read */
+  std::string get_entry(const std::string& filename) const;
+
+  /** Returns the cached image or nullptr if there is no valid entry */
+  SDLSurfacePtr load(const std::string& entry) const;
+
+  /** Writes the image to the cache, it is converted to RGBA first if
+      needed. Failures are only logged. */
+  void store(const std::string& entry, const SDL_Surface& image);
+
+  /** Deletes the oldest entries that weren't loaded or stored during
+      this run until the cache fits into MAX_SIZE again. PhysFS can't
+      touch files, so the age of an entry is the time it was written. */
+  void prune();
+
+private:
+  std::string m_directory;
+  bool m_directory_created;
+
+  /** Entries loaded or stored during this run, prune() keeps them */
+  mutable std::set<std::string> m_used_entries;
+
+private:
+  TextureCache(const TextureCache&) = delete;
+  TextureCache& operator=(const TextureCache&) = delete;
+};
+
+#endif
+
+/* EOF */
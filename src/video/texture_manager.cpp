@@ -22,6 +22,8 @@
 
 #include "math/rect.hpp"
 #include "physfs/physfs_sdl.hpp"
+#include "supertux/gameconfig.hpp"
+#include "supertux/globals.hpp"
 #include "util/file_system.hpp"
 #include "util/log.hpp"
 #include "util/reader_document.hpp"
@@ -31,6 +33,7 @@
 #include "video/sampler.hpp"
 #include "video/sdl_surface.hpp"
 #include "video/texture.hpp"
+#include "video/texture_cache.hpp"
 #include "video/video_system.hpp"
 
 namespace {
@@ -77,7 +80,14 @@ GLenum string2filter(const std::string& text)
 
 TextureManager::TextureManager() :
   m_image_textures(),
-  m_surfaces()
+  m_surfaces(),
+  m_surface_lru(),
+  m_surface_bytes(0),
+  m_texture_lru(),
+  m_texture_bytes(0),
+  m_texture_budget(0),
+  m_frame(0),
+  m_disk_cache(g_config && g_config->texture_cache ? std::make_unique<TextureCache>("texture-cache") : nullptr)
 {
 }
 
@@ -91,7 +101,9 @@ TextureManager::~TextureManager()
     }
   }
   m_image_textures.clear();
+  m_texture_lru.clear();
   m_surfaces.clear();
+  m_surface_lru.clear();
 }
 
 TexturePtr
@@ -184,7 +196,7 @@ TexturePtr
 TextureManager::get(const std::string& _filename)
 {
   std::string filename = FileSystem::normalize(_filename);
-  Texture::Key key(filename, Rect(0, 0, 0, 0));
+  Texture::Key key(filename, Rect(0, 0, 0, 0), Sampler());
   auto i = m_image_textures.find(key);
 
   TexturePtr texture;
@@ -195,6 +207,7 @@ TextureManager::get(const std::string& _filename)
     texture = create_image_texture(filename, Sampler());
     texture->m_cache_key = key;
     m_image_textures[key] = texture;
+    track(*texture);
   }
 
   return texture;
@@ -209,11 +222,11 @@ TextureManager::get(const std::string& _filename,
   Texture::Key key;
   if (rect)
   {
-    key = Texture::Key(filename, *rect);
+    key = Texture::Key(filename, *rect, sampler);
   }
   else
   {
-    key = Texture::Key(filename, Rect());
+    key = Texture::Key(filename, Rect(), sampler);
   }
 
   auto i = m_image_textures.find(key);
@@ -233,6 +246,7 @@ TextureManager::get(const std::string& _filename,
     }
     texture->m_cache_key = key;
     m_image_textures[key] = texture;
+    track(*texture);
   }
 
   return texture;
@@ -273,39 +287,70 @@ TextureManager::get_surface(const std::string& filename)
   auto i = m_surfaces.find(filename);
   if (i != m_surfaces.end())
   {
-    return *i->second;
+    m_surface_lru.splice(m_surface_lru.begin(), m_surface_lru, i->second.lru_pos);
+    return *i->second.surface;
   }
   else
   {
-    SDLSurfacePtr image = SDLSurface::from_file(filename);
-    if (!image)
+    SDLSurfacePtr image = load_image(filename);
+
+    if (image->format->Rmask == 0 &&
+        image->format->Gmask == 0 &&
+        image->format->Bmask == 0 &&
+        image->format->Amask == 0)
     {
-      std::ostringstream msg;
-      msg << "Couldn't load image '" << filename << "' :" << SDL_GetError();
-      throw std::runtime_error(msg.str());
+      log_debug << "Wrong surface format for image " << filename << ". Compensating." << std::endl;
+      image.reset(SDL_ConvertSurfaceFormat(image.get(), SDL_PIXELFORMAT_RGBA8888, 0));
+      if (!image)
+      {
+        throw std::runtime_error("SDL_ConvertSurfaceFormat() call failed");
+      }
     }
 
-    return *(m_surfaces[filename] = std::move(image));
+    m_surface_bytes += static_cast<size_t>(image->pitch * image->h);
+    m_surface_lru.push_front(filename);
+
+    auto& entry = m_surfaces[filename];
+    entry.surface = std::move(image);
+    entry.lru_pos = m_surface_lru.begin();
+    return *entry.surface;
   }
 }
 
-TexturePtr
-TextureManager::create_image_texture_raw(const std::string& filename, const Rect& rect, const Sampler& sampler)
+SDLSurfacePtr
+TextureManager::load_image(const std::string& filename)
 {
-  const SDL_Surface& src_surface = get_surface(filename);
+  std::string cache_entry;
+  if (m_disk_cache)
+  {
+    cache_entry = m_disk_cache->get_entry(filename);
+    SDLSurfacePtr image = m_disk_cache->load(cache_entry);
+    if (image)
+    {
+      return image;
+    }
+  }
 
-  SDLSurfacePtr convert;
-  if (src_surface.format->Rmask == 0 &&
-      src_surface.format->Gmask == 0 &&
-      src_surface.format->Bmask == 0 &&
-      src_surface.format->Amask == 0)
+  SDLSurfacePtr image = SDLSurface::from_file(filename);
+  if (!image)
   {
-    log_debug << "Wrong surface format for image " << filename << ". Compensating." << std::endl;
-    convert.reset(SDL_ConvertSurfaceFormat(const_cast<SDL_Surface*>(&src_surface), SDL_PIXELFORMAT_RGBA8888, 0));
+    std::ostringstream msg;
+    msg << "Couldn't load image '" << filename << "' :" << SDL_GetError();
+    throw std::runtime_error(msg.str());
   }
 
-  const SDL_Surface& surface = convert ? *convert : src_surface;
+  if (m_disk_cache)
+  {
+    m_disk_cache->store(cache_entry, *image);
+  }
+
+  return image;
+}
 
+SDLSurfacePtr
+TextureManager::create_subimage(const SDL_Surface& surface, const Rect& rect) const
+{
+  // the subimage shares the pixels of 'surface'
   SDLSurfacePtr subimage(SDL_CreateRGBSurfaceFrom(static_cast<uint8_t*>(surface.pixels) +
                                                   rect.top * surface.pitch +
                                                   rect.left * surface.format->BytesPerPixel,
@@ -321,7 +366,34 @@ TextureManager::create_image_texture_raw(const std::string& filename, const Rect
     throw std::runtime_error("SDL_CreateRGBSurfaceFrom() call failed");
   }
 
-  return VideoSystem::current()->new_texture(*subimage, sampler);
+  return subimage;
+}
+
+void
+TextureManager::trim_surface_cache()
+{
+  while (m_surface_bytes > SURFACE_CACHE_BUDGET && m_surface_lru.size() > 1)
+  {
+    auto i = m_surfaces.find(m_surface_lru.back());
+    assert(i != m_surfaces.end());
+
+    m_surface_bytes -= static_cast<size_t>(i->second.surface->pitch * i->second.surface->h);
+    m_surfaces.erase(i);
+    m_surface_lru.pop_back();
+  }
+}
+
+TexturePtr
+TextureManager::create_image_texture_raw(const std::string& filename, const Rect& rect, const Sampler& sampler)
+{
+  SDLSurfacePtr subimage = create_subimage(get_surface(filename), rect);
+  TexturePtr texture = VideoSystem::current()->new_texture(*subimage, sampler);
+  subimage.reset(nullptr);
+
+  // only now that the pixels are uploaded the image may be dropped
+  trim_surface_cache();
+
+  return texture;
 }
 
 TexturePtr
@@ -341,19 +413,10 @@ TextureManager::create_image_texture(const std::string& filename, const Sampler&
 TexturePtr
 TextureManager::create_image_texture_raw(const std::string& filename, const Sampler& sampler)
 {
-  SDLSurfacePtr image = SDLSurface::from_file(filename);
-  if (!image)
-  {
-    std::ostringstream msg;
-    msg << "Couldn't load image '" << filename << "' :" << SDL_GetError();
-    throw std::runtime_error(msg.str());
-  }
-  else
-  {
-    TexturePtr texture = VideoSystem::current()->new_texture(*image, sampler);
-    image.reset(nullptr);
-    return texture;
-  }
+  SDLSurfacePtr image = load_image(filename);
+  TexturePtr texture = VideoSystem::current()->new_texture(*image, sampler);
+  image.reset(nullptr);
+  return texture;
 }
 
 TexturePtr
@@ -385,6 +448,134 @@ TextureManager::create_dummy_texture()
   }
 }
 
+void
+TextureManager::track(Texture& texture)
+{
+  texture.m_memory_usage = static_cast<size_t>(texture.get_texture_width()) *
+    static_cast<size_t>(texture.get_texture_height()) * 4;
+  texture.m_last_used_frame = m_frame;
+  texture.m_unloaded = false;
+
+  m_texture_lru.push_front(&texture);
+  texture.m_lru_pos = m_texture_lru.begin();
+  m_texture_bytes += texture.m_memory_usage;
+}
+
+void
+TextureManager::untrack(Texture& texture)
+{
+  if (!texture.m_unloaded)
+  {
+    m_texture_lru.erase(texture.m_lru_pos);
+    m_texture_bytes -= texture.m_memory_usage;
+  }
+}
+
+void
+TextureManager::touch(const Texture& const_texture)
+{
+  // drawing requests only hold const textures, residency doesn't
+  // change what they draw
+  Texture& texture = const_cast<Texture&>(const_texture);
+
+  if (!texture.m_cache_key)
+    return;
+
+  texture.m_last_used_frame = m_frame;
+
+  if (texture.m_unloaded)
+  {
+    reload(texture);
+  }
+  else
+  {
+    m_texture_lru.splice(m_texture_lru.begin(), m_texture_lru, texture.m_lru_pos);
+  }
+}
+
+void
+TextureManager::reload(Texture& texture)
+{
+  const std::string& filename = std::get<0>(*texture.m_cache_key);
+  const Rect& rect = std::get<1>(*texture.m_cache_key);
+
+  try
+  {
+    if (rect == Rect())
+    {
+      SDLSurfacePtr image = load_image(filename);
+      texture.reload(*image);
+    }
+    else
+    {
+      SDLSurfacePtr subimage = create_subimage(get_surface(filename), rect);
+      texture.reload(*subimage);
+      subimage.reset(nullptr);
+      trim_surface_cache();
+    }
+  }
+  catch(const std::exception& err)
+  {
+    // textures that fell back to the dummy texture end up here too
+    log_warning << "Couldn't reload texture '" << filename << "' (now using empty one): " << err.what() << std::endl;
+    SDLSurfacePtr image = SDLSurface::create_rgba(texture.get_image_width(), texture.get_image_height());
+    SDL_FillRect(image.get(), nullptr, 0);
+    texture.reload(*image);
+  }
+
+  m_texture_lru.push_front(&texture);
+  texture.m_lru_pos = m_texture_lru.begin();
+  texture.m_unloaded = false;
+  m_texture_bytes += texture.m_memory_usage;
+}
+
+void
+TextureManager::new_frame()
+{
+  if (m_texture_budget > 0)
+  {
+    // Only textures that weren't drawn in this frame are unloaded,
+    // they sit at the end of the list
+    while (m_texture_bytes > m_texture_budget && !m_texture_lru.empty())
+    {
+      Texture& texture = *m_texture_lru.back();
+      if (texture.m_last_used_frame >= m_frame || !texture.unload())
+        break;
+
+      m_texture_lru.pop_back();
+      texture.m_unloaded = true;
+      m_texture_bytes -= texture.m_memory_usage;
+    }
+  }
+
+  m_frame += 1;
+}
+
+void
+TextureManager::print_memory_usage(std::ostream& out) const
+{
+  int unloaded_count = 0;
+  for (const auto& it : m_image_textures)
+  {
+    auto texture = it.second.lock();
+    if (texture && texture->m_unloaded)
+    {
+      unloaded_count += 1;
+    }
+  }
+
+  out << "Textures: " << m_texture_lru.size() << " loaded, " << unloaded_count << " unloaded, "
+      << m_texture_bytes / 1024 << " KiB";
+  if (m_texture_budget > 0)
+  {
+    out << " of " << m_texture_budget / 1024 << " KiB";
+  }
+  out << std::endl;
+
+  out << "Images: " << m_surfaces.size() << " cached, "
+      << m_surface_bytes / 1024 << " KiB of " << SURFACE_CACHE_BUDGET / 1024 << " KiB" << std::endl;
+}
+
 void
 TextureManager::debug_print(std::ostream& out) const
 {
@@ -409,7 +600,7 @@ TextureManager::debug_print(std::ostream& out) const
   for(const auto& it : m_surfaces)
   {
     const auto& filename = it.first;
-    const auto& surface = it.second;
+    const auto& surface = it.second.surface;
 
     total_surface_pixels += surface->w * surface->h;
     out << "  surface filename:" << filename << " " << surface->w << "x" << surface->h << std::endl;
@@ -421,6 +612,8 @@ TextureManager::debug_print(std::ostream& out) const
 
   out << "total surface count:" << m_surfaces.size() << std::endl;
   out << "total surface pixels:" << total_surface_pixels << std::endl;
+
+  print_memory_usage(out);
 }
 
 /* EOF */
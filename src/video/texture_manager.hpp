@@ -18,6 +18,7 @@
 #define HEADER_SUPERTUX_VIDEO_TEXTURE_MANAGER_HPP
 
 #include <config.h>
+#include <list>
 #include <map>
 #include <memory>
 #include <ostream>
@@ -35,6 +36,7 @@
 
 class GLTexture;
 class ReaderMapping;
+class TextureCache;
 struct SDL_Surface;
 
 class TextureManager final : public Currenton<TextureManager>
@@ -42,6 +44,11 @@ class TextureManager final : public Currenton<TextureManager>
 public:
   friend class Texture;
 
+  /** Decoded images are kept after upload, as most of them are cut
+      into several textures, until they take up more than this many
+      bytes. The most recently used image is always kept. */
+  static const size_t SURFACE_CACHE_BUDGET = 64 * 1024 * 1024;
+
 public:
   TextureManager();
   ~TextureManager();
@@ -54,9 +61,35 @@ public:
 
   void debug_print(std::ostream& out) const;
 
+  /** Prints the bytes used by the texture and the image cache */
+  void print_memory_usage(std::ostream& out) const;
+
+  /** Limits the memory used by textures, least recently drawn
+      textures get unloaded once it is exceeded and are reloaded
+      transparently on their next use. 0 disables the limit. */
+  void set_texture_budget(size_t bytes) { m_texture_budget = bytes; }
+  size_t get_texture_budget() const { return m_texture_budget; }
+
+  /** Marks the texture as used in this frame and reloads it, if it
+      got unloaded, has to be called before it is drawn */
+  void touch(const Texture& texture);
+
+  /** Unloads textures that exceed the budget, called after a frame
+      has been presented */
+  void new_frame();
+
 private:
   const SDL_Surface& get_surface(const std::string& filename);
+
+  /** Decodes the image or takes it from the disk cache */
+  SDLSurfacePtr load_image(const std::string& filename);
+  SDLSurfacePtr create_subimage(const SDL_Surface& surface, const Rect& rect) const;
+  void trim_surface_cache();
+
   void reap_cache_entry(const Texture::Key& key);
+  void track(Texture& texture);
+  void untrack(Texture& texture);
+  void reload(Texture& texture);
 
   TexturePtr create_image_texture(const std::string& filename, const Rect& rect, const Sampler& sampler);
 
@@ -70,8 +103,26 @@ private:
   TexturePtr create_dummy_texture();
 
 private:
+  struct CachedSurface
+  {
+    SDLSurfacePtr surface;
+    std::list<std::string>::iterator lru_pos;
+  };
+
   std::map<Texture::Key, std::weak_ptr<Texture> > m_image_textures;
-  std::map<std::string, SDLSurfacePtr> m_surfaces;
+  std::map<std::string, CachedSurface> m_surfaces;
+
+  /** Most recently used first */
+  std::list<std::string> m_surface_lru;
+  size_t m_surface_bytes;
+
+  /** Loaded textures with a cache key, most recently used first */
+  std::list<Texture*> m_texture_lru;
+  size_t m_texture_bytes;
+  size_t m_texture_budget;
+  int m_frame;
+
+  std::unique_ptr<TextureCache> m_disk_cache;
 
 private:
   TextureManager(const TextureManager&) = delete;
@@ -47,4 +47,49 @@ TEST(collisionTest, intersects_test)
     ASSERT_EQ(true, collision::intersects(r9, r10));
 }
 
+TEST(collisionTest, sweep_test)
+{
+    Rectf r1(0.0,0.0,10.0,10.0);
+    Rectf thin_wall(50.0,0.0,52.0,10.0);
+
+    // would tunnel through the wall in a single step
+    ASSERT_FLOAT_EQ(0.4f, collision::sweep(r1, Vector(100.0,0.0), thin_wall));
+    ASSERT_FLOAT_EQ(1.0f, collision::sweep(r1, Vector(-100.0,0.0), thin_wall));
+    ASSERT_FLOAT_EQ(1.0f, collision::sweep(r1, Vector(30.0,0.0), thin_wall));
+
+    // passes above the wall
+    ASSERT_FLOAT_EQ(1.0f, collision::sweep(r1, Vector(100.0,-100.0), thin_wall));
+
+    Rectf floor(0.0,100.0,10.0,132.0);
+    ASSERT_FLOAT_EQ(0.5f, collision::sweep(r1, Vector(0.0,180.0), floor));
+
+    // already overlapping
+    ASSERT_FLOAT_EQ(1.0f, collision::sweep(r1, Vector(10.0,0.0), Rectf(5.0,5.0,15.0,15.0)));
+
+    // pressed against the thin wall, must not pass through it
+    Rectf touching_wall(10.0,0.0,12.0,10.0);
+    ASSERT_FLOAT_EQ(0.0f, collision::sweep(r1, Vector(100.0,0.0), touching_wall));
+    ASSERT_FLOAT_EQ(1.0f, collision::sweep(r1, Vector(-100.0,0.0), touching_wall));
+}
+
+TEST(collisionTest, sweep_sliding_test)
+{
+    // fast object sliding on floor keeps its full movement, both when
+    // touching the floor and when resting slightly above it
+    Rectf r1(0.0,0.0,10.0,10.0);
+    for (float top : {10.0f, 10.002f}) {
+        Rectf floor_below(0.0,top,32.0,top+32.0);
+        Rectf floor_ahead(32.0,top,64.0,top+32.0);
+        for (float gravity : {0.0f, 0.5f, -0.5f}) {
+            ASSERT_FLOAT_EQ(1.0f, collision::sweep(r1, Vector(100.0,gravity), floor_below));
+            ASSERT_FLOAT_EQ(1.0f, collision::sweep(r1, Vector(100.0,gravity), floor_ahead));
+            ASSERT_FLOAT_EQ(1.0f, collision::sweep(r1, Vector(-100.0,gravity), floor_below));
+        }
+    }
+
+    // a wall standing on the floor still stops it
+    Rectf wall(50.0,-22.0,52.0,10.0);
+    ASSERT_FLOAT_EQ(0.4f, collision::sweep(r1, Vector(100.0,0.5), wall));
+}
+
 /* EOF */
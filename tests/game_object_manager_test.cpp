@@ -0,0 +1,122 @@
+//  SuperTux
+//  Copyright (C) 2020 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "supertux/game_object_manager.hpp"
+
+namespace {
+
+class Base : public GameObject
+{
+public:
+  Base(int id) : m_id(id) {}
+  virtual void update(float) override {}
+  virtual void draw(DrawingContext&) override {}
+
+  int m_id;
+};
+
+class Derived final : public Base
+{
+public:
+  Derived(int id) : Base(id) {}
+};
+
+class Marker
+{
+public:
+  virtual ~Marker() {}
+};
+
+class Marked final : public GameObject,
+                     public Marker
+{
+public:
+  virtual void update(float) override {}
+  virtual void draw(DrawingContext&) override {}
+};
+
+class TestManager final : public GameObjectManager
+{
+public:
+  ~TestManager() { clear_objects(); }
+
+  virtual bool before_object_add(GameObject&) override { return true; }
+  virtual void before_object_remove(GameObject&) override {}
+};
+
+std::vector<int> get_ids(const TestManager& manager)
+{
+  std::vector<int> ids;
+  for (const auto& obj : manager.get_objects_by_type<Base>()) {
+    ids.push_back(obj.m_id);
+  }
+  return ids;
+}
+
+} // namespace
+
+TEST(GameObjectManagerTest, count_by_base_type)
+{
+  TestManager manager;
+  manager.add<Base>(1);
+  manager.add<Derived>(2);
+  manager.add<Marked>();
+  manager.flush_game_objects();
+
+  ASSERT_EQ(2, manager.get_object_count<Base>());
+  ASSERT_EQ(1, manager.get_object_count<Derived>());
+  ASSERT_EQ(1, manager.get_object_count<Marker>());
+  ASSERT_EQ(3, manager.get_object_count<GameObject>());
+  ASSERT_EQ(1, manager.get_object_count<Base>([](const Base& obj) { return obj.m_id == 2; }));
+}
+
+TEST(GameObjectManagerTest, registry_follows_changes)
+{
+  TestManager manager;
+  manager.add<Base>(1);
+  auto& removed = manager.add<Derived>(2);
+  manager.flush_game_objects();
+
+  ASSERT_EQ((std::vector<int>{1, 2}), get_ids(manager));
+
+  removed.remove_me();
+  manager.add<Derived>(3);
+  manager.add<Marked>();
+  manager.add<Base>(4);
+  manager.flush_game_objects();
+
+  ASSERT_EQ((std::vector<int>{1, 3, 4}), get_ids(manager));
+  ASSERT_EQ(1, manager.get_object_count<Derived>());
+  ASSERT_EQ(1, manager.get_object_count<Marker>());
+}
+
+TEST(GameObjectManagerTest, cross_cast)
+{
+  TestManager manager;
+  auto& marked = manager.add<Marked>();
+  manager.add<Base>(1);
+  manager.flush_game_objects();
+
+  const auto& range = manager.get_objects_by_type<Marker>();
+  ASSERT_TRUE(range.begin() != range.end());
+  ASSERT_EQ(static_cast<Marker*>(&marked), &*range.begin());
+}
+
+/* EOF */
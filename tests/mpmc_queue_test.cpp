@@ -0,0 +1,93 @@
+//  SuperTux
+//  Copyright (C) 2020 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "util/mpmc_queue.hpp"
+
+TEST(MPMCQueueTest, fifo)
+{
+  MPMCQueue<int> queue(4);
+  int value = 0;
+
+  ASSERT_FALSE(queue.try_pop(value));
+
+  for (int i = 0; i < 4; ++i) {
+    ASSERT_TRUE(queue.try_push(std::move(i)));
+  }
+  ASSERT_FALSE(queue.try_push(4));
+
+  for (int i = 0; i < 4; ++i) {
+    ASSERT_TRUE(queue.try_pop(value));
+    ASSERT_EQ(i, value);
+  }
+  ASSERT_FALSE(queue.try_pop(value));
+
+  // wrap around the ring a few times
+  for (int i = 0; i < 10; ++i) {
+    ASSERT_TRUE(queue.try_push(std::move(i)));
+    ASSERT_TRUE(queue.try_pop(value));
+    ASSERT_EQ(i, value);
+  }
+}
+
+TEST(MPMCQueueTest, threads)
+{
+  const int threads = 4;
+  const int count = 20000;
+
+  MPMCQueue<int> queue(64);
+  std::atomic<long long> sum(0);
+  std::atomic<int> popped(0);
+
+  std::vector<std::thread> workers;
+  for (int t = 0; t < threads; ++t)
+  {
+    workers.emplace_back([&queue]{
+        for (int i = 1; i <= count; ++i) {
+          int value = i;
+          while (!queue.try_push(std::move(value))) {
+            std::this_thread::yield();
+          }
+        }
+      });
+
+    workers.emplace_back([&queue, &sum, &popped]{
+        int value;
+        while (popped < threads * count) {
+          if (queue.try_pop(value)) {
+            sum += value;
+            popped += 1;
+          } else {
+            std::this_thread::yield();
+          }
+        }
+      });
+  }
+
+  for (auto& worker : workers) {
+    worker.join();
+  }
+
+  ASSERT_EQ(threads * count, popped);
+  ASSERT_EQ(static_cast<long long>(threads) * count * (count + 1) / 2, sum);
+}
+
+/* EOF */
@@ -0,0 +1,84 @@
+//  SuperTux
+//  Copyright (C) 2020 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <gtest/gtest.h>
+
+#include "util/prefix_trie.hpp"
+
+namespace {
+
+std::vector<std::string> find(const PrefixTrie& trie, const std::string& prefix)
+{
+  std::vector<std::string> result;
+  trie.find(prefix, result);
+  return result;
+}
+
+} // namespace
+
+TEST(PrefixTrieTest, find)
+{
+  PrefixTrie trie;
+  trie.add("play_music()");
+  trie.add("play_sound()");
+  trie.add("Level.");
+  trie.add("play");
+
+  ASSERT_EQ((std::vector<std::string>{"play", "play_music()", "play_sound()"}), find(trie, "pl"));
+  ASSERT_EQ((std::vector<std::string>{"play_sound()"}), find(trie, "play_s"));
+  ASSERT_EQ((std::vector<std::string>{"Level.", "play", "play_music()", "play_sound()"}), find(trie, ""));
+  ASSERT_TRUE(find(trie, "stop").empty());
+  ASSERT_TRUE(find(trie, "play_music()x").empty());
+}
+
+TEST(PrefixTrieTest, contains)
+{
+  PrefixTrie trie;
+  trie.add("tux.");
+  trie.add("tuxdoll.");
+
+  ASSERT_TRUE(trie.contains("tux."));
+  ASSERT_TRUE(trie.contains("tuxdoll."));
+  ASSERT_FALSE(trie.contains("tux"));
+  ASSERT_FALSE(trie.contains("penny."));
+
+  trie.remove("tux.");
+  ASSERT_FALSE(trie.contains("tux."));
+}
+
+TEST(PrefixTrieTest, remove)
+{
+  PrefixTrie trie;
+  trie.add("tux.");
+  trie.add("tux.");
+  trie.add("tuxdoll.");
+
+  trie.remove("tux.");
+  ASSERT_EQ((std::vector<std::string>{"tux.", "tuxdoll."}), find(trie, "tux"));
+
+  trie.remove("tux.");
+  ASSERT_EQ((std::vector<std::string>{"tuxdoll."}), find(trie, "tux"));
+
+  // unknown keys and prefixes of keys are ignored
+  trie.remove("tux");
+  trie.remove("penny.");
+  ASSERT_EQ((std::vector<std::string>{"tuxdoll."}), find(trie, ""));
+
+  trie.remove("tuxdoll.");
+  ASSERT_TRUE(trie.empty());
+}
+
+/* EOF */
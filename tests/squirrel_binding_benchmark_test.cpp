@@ -0,0 +1,137 @@
+//  SuperTux
+//  Copyright (C) 2020 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+// Micro-benchmark for the call shapes miniswig generates, run through
+// the real generated wrappers of objects that need no loaded data. The
+// benchmarks are disabled by default, run them with:
+//
+//   test_supertux2 --gtest_also_run_disabled_tests --gtest_filter='SquirrelBindingBenchmark.*'
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <iostream>
+#include <string>
+
+#include <squirrel.h>
+
+#include "object/gradient.hpp"
+#include "object/text_object.hpp"
+#include "scripting/game_object.hpp"
+#include "scripting/wrapper.hpp"
+#include "supertux/game_object_manager.hpp"
+
+namespace {
+
+const int ITERATIONS = 1000000;
+
+class BenchmarkManager final : public GameObjectManager
+{
+public:
+  ~BenchmarkManager() { clear_objects(); }
+
+  virtual bool before_object_add(GameObject&) override { return true; }
+  virtual void before_object_remove(GameObject&) override {}
+};
+
+class SquirrelBindingBenchmark : public ::testing::Test
+{
+protected:
+  SquirrelBindingBenchmark() :
+    m_manager(),
+    m_vm(sq_open(1024))
+  {}
+
+  ~SquirrelBindingBenchmark()
+  {
+    sq_close(m_vm);
+    scripting::set_fallback_game_object_manager(nullptr);
+  }
+
+  void SetUp() override
+  {
+    scripting::set_fallback_game_object_manager(&m_manager);
+
+    auto& text = m_manager.add<TextObject>("text");
+    auto& gradient = m_manager.add<Gradient>();
+    gradient.set_name("gradient");
+    m_manager.flush_game_objects();
+
+    sq_pushroottable(m_vm);
+    scripting::register_supertux_wrapper(m_vm);
+    text.expose(m_vm, -1);
+    gradient.expose(m_vm, -1);
+    sq_pop(m_vm, 1);
+  }
+
+  /** Runs the loop body ITERATIONS times and reports the calls per second */
+  void run(const std::string& name, const std::string& body, int calls_per_iteration = 1)
+  {
+    const std::string source =
+      "local t = text;\n"
+      "local g = gradient;\n"
+      "for (local i = 0; i < " + std::to_string(ITERATIONS) + "; i += 1) {\n" +
+      body + "\n"
+      "}\n";
+
+    ASSERT_TRUE(SQ_SUCCEEDED(sq_compilebuffer(m_vm, source.c_str(), static_cast<SQInteger>(source.size()),
+                                              name.c_str(), SQTrue)));
+
+    const auto start = std::chrono::steady_clock::now();
+    sq_pushroottable(m_vm);
+    ASSERT_TRUE(SQ_SUCCEEDED(sq_call(m_vm, 1, SQFalse, SQTrue)));
+    const auto end = std::chrono::steady_clock::now();
+    sq_pop(m_vm, 1);
+
+    const double seconds = std::chrono::duration<double>(end - start).count();
+    std::cout << name << ": "
+              << static_cast<long long>(ITERATIONS * calls_per_iteration / seconds) << " calls/s, "
+              << static_cast<long long>(ITERATIONS / seconds) << " iterations/s" << std::endl;
+  }
+
+protected:
+  BenchmarkManager m_manager;
+  HSQUIRRELVM m_vm;
+};
+
+} // namespace
+
+TEST_F(SquirrelBindingBenchmark, DISABLED_float_getter)
+{
+  run("Text.get_pos_x + Text.get_pos_y", "local x = t.get_pos_x(); local y = t.get_pos_y();", 2);
+}
+
+TEST_F(SquirrelBindingBenchmark, DISABLED_batch_getter)
+{
+  run("Text.get_pos", "local p = t.get_pos(); local x = p[0]; local y = p[1];");
+}
+
+TEST_F(SquirrelBindingBenchmark, DISABLED_float_setter)
+{
+  run("Text.set_pos", "t.set_pos(1.0, 2.0);");
+}
+
+TEST_F(SquirrelBindingBenchmark, DISABLED_string_argument)
+{
+  run("Gradient.set_direction", "g.set_direction(\"horizontal\");");
+}
+
+TEST_F(SquirrelBindingBenchmark, DISABLED_string_return)
+{
+  run("Gradient.get_direction", "local d = g.get_direction();");
+}
+
+/* EOF */
@@ -0,0 +1,66 @@
+//  SuperTux
+//  Copyright (C) 2020 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include <gtest/gtest.h>
+
+#include "supertux/game_object.hpp"
+#include "supertux/statistics_totals.hpp"
+
+namespace {
+
+class DummyObject final : public GameObject
+{
+public:
+  virtual void update(float) override {}
+  virtual void draw(DrawingContext&) override {}
+};
+
+} // namespace
+
+TEST(StatisticsTotalsTest, collected_coin_stays_in_total)
+{
+  DummyObject coin, badguy;
+  StatisticsTotals totals;
+  totals.add(coin, { 1, 0, 0 });
+  totals.add(badguy, { 0, 1, 0 });
+
+  // collected or killed while playing
+  totals.remove(coin, false);
+  totals.remove(badguy, false);
+
+  ASSERT_EQ(1, totals.get_coins());
+  ASSERT_EQ(1, totals.get_badguys());
+}
+
+TEST(StatisticsTotalsTest, deleted_object_leaves_total)
+{
+  DummyObject coin, block;
+  StatisticsTotals totals;
+  totals.add(coin, { 1, 0, 0 });
+  totals.add(block, { 5, 0, 0 });
+
+  // deleted in the editor
+  totals.remove(block, true);
+  ASSERT_EQ(1, totals.get_coins());
+
+  // an object that was collected before can't be subtracted again
+  totals.remove(coin, false);
+  totals.remove(coin, true);
+  ASSERT_EQ(1, totals.get_coins());
+}
+
+/* EOF */
@@ -0,0 +1,121 @@
+//  SuperTux
+//  Copyright (C) 2020 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+// Compares decoding the forest tileset against reading it from the
+// texture cache. The benchmark is disabled by default, run it from
+// the source directory with:
+//
+//   test_supertux2 --gtest_also_run_disabled_tests --gtest_filter='TextureCacheBenchmark.*'
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <iostream>
+#include <physfs.h>
+#include <string>
+#include <vector>
+
+#include "util/string_util.hpp"
+#include "video/sdl_surface.hpp"
+#include "video/texture_cache.hpp"
+
+namespace {
+
+const char* TILESET_DIRECTORY = "images/tiles/forest";
+const char* CACHE_DIRECTORY = "texture-cache";
+
+class TextureCacheBenchmark : public ::testing::Test
+{
+protected:
+  TextureCacheBenchmark() :
+    m_filenames()
+  {}
+
+  void SetUp() override
+  {
+    ASSERT_TRUE(PHYSFS_init(nullptr));
+    ASSERT_TRUE(PHYSFS_mount("data", nullptr, 1));
+
+    const char* prefdir = PHYSFS_getPrefDir("SuperTux", "texture-cache-benchmark");
+    ASSERT_TRUE(prefdir);
+    ASSERT_TRUE(PHYSFS_setWriteDir(prefdir));
+    ASSERT_TRUE(PHYSFS_mount(prefdir, nullptr, 0));
+
+    char** files = PHYSFS_enumerateFiles(TILESET_DIRECTORY);
+    for (char** i = files; *i != nullptr; ++i)
+    {
+      if (StringUtil::has_suffix(*i, ".png"))
+      {
+        m_filenames.push_back(std::string(TILESET_DIRECTORY) + "/" + *i);
+      }
+    }
+    PHYSFS_freeList(files);
+    ASSERT_FALSE(m_filenames.empty());
+  }
+
+  void TearDown() override
+  {
+    char** files = PHYSFS_enumerateFiles(CACHE_DIRECTORY);
+    for (char** i = files; *i != nullptr; ++i)
+    {
+      PHYSFS_delete((std::string(CACHE_DIRECTORY) + "/" + *i).c_str());
+    }
+    PHYSFS_freeList(files);
+    PHYSFS_delete(CACHE_DIRECTORY);
+
+    PHYSFS_deinit();
+  }
+
+  void report(const std::string& name, std::chrono::steady_clock::time_point start)
+  {
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::cout << name << ": " << m_filenames.size() << " images in "
+              << seconds * 1000.0 << " ms" << std::endl;
+  }
+
+protected:
+  std::vector<std::string> m_filenames;
+};
+
+} // namespace
+
+TEST_F(TextureCacheBenchmark, DISABLED_cold_vs_warm)
+{
+  TextureCache cache(CACHE_DIRECTORY);
+
+  auto start = std::chrono::steady_clock::now();
+  for (const auto& filename : m_filenames)
+  {
+    SDLSurfacePtr image = SDLSurface::from_file(filename);
+    ASSERT_TRUE(image.get());
+  }
+  report("decode", start);
+
+  for (const auto& filename : m_filenames)
+  {
+    cache.store(cache.get_entry(filename), *SDLSurface::from_file(filename));
+  }
+
+  start = std::chrono::steady_clock::now();
+  for (const auto& filename : m_filenames)
+  {
+    SDLSurfacePtr image = cache.load(cache.get_entry(filename));
+    ASSERT_TRUE(image.get());
+  }
+  report("texture cache", start);
+}
+
+/* EOF */
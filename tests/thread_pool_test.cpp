@@ -0,0 +1,70 @@
+//  SuperTux
+//  Copyright (C) 2020 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <vector>
+
+#include "util/thread_pool.hpp"
+
+TEST(ThreadPoolTest, parallel_for)
+{
+  ThreadPool pool(3);
+
+  for (int run = 0; run < 100; ++run)
+  {
+    std::vector<int> values(1000, 0);
+    pool.parallel_for(values.size(), [&values](size_t i) {
+      values[i] += static_cast<int>(i);
+    });
+
+    for (size_t i = 0; i < values.size(); ++i)
+    {
+      ASSERT_EQ(static_cast<int>(i), values[i]);
+    }
+  }
+}
+
+TEST(ThreadPoolTest, no_threads)
+{
+  ThreadPool pool(0);
+
+  std::vector<int> values(10, 0);
+  pool.parallel_for(values.size(), [&values](size_t i) {
+    values[i] = 1;
+  });
+
+  ASSERT_EQ(std::vector<int>(10, 1), values);
+}
+
+TEST(ThreadPoolTest, exception)
+{
+  ThreadPool pool(2);
+
+  ASSERT_THROW(pool.parallel_for(100, [](size_t i) {
+    if (i == 50) {
+      throw std::runtime_error("fail");
+    }
+  }), std::runtime_error);
+
+  // the pool is still usable afterwards
+  int count = 0;
+  pool.parallel_for(1, [&count](size_t) { count += 1; });
+  ASSERT_EQ(1, count);
+}
+
+/* EOF */
@@ -0,0 +1,68 @@
+//  SuperTux
+//  Copyright (C) 2020 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include <gtest/gtest.h>
+
+#include "supertux/tile_storage.hpp"
+
+TEST(TileStorageTest, empty)
+{
+  TileStorage storage;
+  storage.reset(40, 20);
+
+  ASSERT_EQ(40, storage.get_width());
+  ASSERT_EQ(20, storage.get_height());
+  ASSERT_EQ(3, storage.get_chunks_width());
+  ASSERT_EQ(2, storage.get_chunks_height());
+  ASSERT_EQ(0u, storage.get(39, 19));
+  ASSERT_TRUE(storage.is_chunk_empty(2, 1));
+}
+
+TEST(TileStorageTest, set_get)
+{
+  TileStorage storage;
+  storage.reset(40, 20);
+
+  storage.set(17, 3, 42);
+  ASSERT_EQ(42u, storage.get(17, 3));
+  ASSERT_FALSE(storage.is_chunk_empty(1, 0));
+  ASSERT_TRUE(storage.is_chunk_empty(0, 0));
+
+  storage.set(18, 3, 0x12345678);
+  ASSERT_EQ(42u, storage.get(17, 3));
+  ASSERT_EQ(0x12345678u, storage.get(18, 3));
+
+  storage.set(17, 3, 0);
+  storage.set(18, 3, 0);
+  ASSERT_TRUE(storage.is_chunk_empty(1, 0));
+}
+
+TEST(TileStorageTest, assign_to_vector)
+{
+  std::vector<uint32_t> tiles(33 * 17);
+  for (size_t i = 0; i < tiles.size(); ++i) {
+    tiles[i] = (i % 7 == 0) ? static_cast<uint32_t>(i) : 0;
+  }
+
+  TileStorage storage;
+  storage.assign(33, 17, tiles);
+  ASSERT_EQ(tiles, storage.to_vector());
+  ASSERT_EQ(tiles[16 * 33 + 14], storage.get(14, 16));
+  ASSERT_THROW(storage.assign(2, 2, tiles), std::runtime_error);
+}
+
+/* EOF */
@@ -0,0 +1,82 @@
+//  SuperTux
+//  Copyright (C) 2020 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <tinygettext/file_system.hpp>
+#include <tinygettext/tinygettext.hpp>
+
+#include "util/translated_string.hpp"
+
+namespace {
+
+/** Serves a single German catalog from memory */
+class MemoryFileSystem final : public tinygettext::FileSystem
+{
+public:
+  virtual std::vector<std::string> open_directory(const std::string& /*pathname*/) override
+  {
+    return { "de.po" };
+  }
+
+  virtual std::unique_ptr<std::istream> open_file(const std::string& /*filename*/) override
+  {
+    return std::make_unique<std::istringstream>(
+      "msgid \"\"\n"
+      "msgstr \"\"\n"
+      "\"Content-Type: text/plain; charset=UTF-8\\n\"\n"
+      "\n"
+      "msgid \"Coins\"\n"
+      "msgstr \"Taler\"\n");
+  }
+};
+
+} // namespace
+
+TEST(TranslatedStringTest, untranslated)
+{
+  // without a dictionary the message is its own translation
+  const TranslatedString text("Coins");
+  ASSERT_EQ("Coins", text.get());
+  ASSERT_EQ("Coins", text.get_message());
+}
+
+TEST(TranslatedStringTest, cached)
+{
+  const TranslatedString text("Coins");
+  const std::string* first = &text.get();
+  ASSERT_EQ(first, &text.get());
+  ASSERT_EQ(first->data(), text.get().data());
+
+  // switching the language only shows up after invalidation
+  g_dictionary_manager.reset(new tinygettext::DictionaryManager(std::make_unique<MemoryFileSystem>(), "UTF-8"));
+  g_dictionary_manager->add_directory("locale");
+  g_dictionary_manager->set_language(tinygettext::Language::from_name("de"));
+  ASSERT_EQ("Coins", text.get());
+
+  invalidate_translations();
+  ASSERT_EQ("Taler", text.get());
+
+  g_dictionary_manager.reset();
+  invalidate_translations();
+  ASSERT_EQ("Coins", text.get());
+}
+
+/* EOF */
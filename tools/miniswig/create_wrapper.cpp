@@ -138,6 +138,11 @@ WrapperCreator::create_register_function_code(Function* function, Class* _class)
           }
 
           for(; p != function->parameters.end(); ++p) {
+            if(is_output_parameter(p->type)) {
+              // filled in by the function and returned, not passed
+              continue;
+            }
+
             if(p->type.atomic_type == &BasicType::INT) {
               out << "i";
             } else if(p->type.atomic_type == &BasicType::FLOAT) {
@@ -329,21 +334,37 @@ WrapperCreator::create_function_wrapper(Class* _class, Function* function)
         return;
     }
 
-    // declare and retrieve arguments
+    // declare and retrieve arguments, output parameters are only
+    // declared and don't take a slot on the stack
     int i = 0;
-    int arg_offset = 2;
+    int stack_index = 2;
+    int output_count = 0;
     for(auto& p : function->parameters) {
+        char argname[64];
+        snprintf(argname, sizeof(argname), "arg%d", i);
         if(i == 0 && p.type.atomic_type == HSQUIRRELVMType::instance()) {
             out << ind << "HSQUIRRELVM arg0 = vm;\n";
-            arg_offset--;
+        } else if(is_output_parameter(p.type)) {
+            Type value_type = p.type;
+            value_type.ref = 0;
+            out << ind;
+            value_type.write_c_type(out);
+            out << " " << argname << " = {};\n";
+            ++output_count;
         } else {
-            char argname[64];
-            snprintf(argname, sizeof(argname), "arg%d", i);
-            prepare_argument(p.type, i + arg_offset, argname);
+            prepare_argument(p.type, stack_index, argname);
+            ++stack_index;
         }
         ++i;
     }
 
+    if(output_count > 0 && (!function->return_type.is_void() || function->suspend)) {
+        std::stringstream msg;
+        msg << "Function '" << function->name << "' has output parameters"
+            << " but also a return value or is declared as suspend.";
+        throw std::runtime_error(msg.str());
+    }
+
     // call function
     out << "\n";
     out << ind << "try {\n";
@@ -402,6 +423,22 @@ WrapperCreator::create_function_wrapper(Class* _class, Function* function)
             throw std::runtime_error(msg.str());
         }
         out << ind << ind << "return sq_suspendvm(vm);\n";
+    } else if(output_count > 0) {
+        // return all output parameters at once as an array
+        out << ind << ind << "sq_newarray(vm, 0);\n";
+        for(size_t i = 0; i < function->parameters.size(); ++i) {
+            const Parameter& param = function->parameters[i];
+            if(!is_output_parameter(param.type))
+                continue;
+
+            Type value_type = param.type;
+            value_type.ref = 0;
+            char argname[64];
+            snprintf(argname, sizeof(argname), "arg%d", static_cast<int>(i));
+            push_to_stack(value_type, argname);
+            out << ind << ind << "sq_arrayappend(vm, -2);\n";
+        }
+        out << ind << ind << "return 1;\n";
     } else if(function->return_type.is_void()) {
         out << ind << ind << "return 0;\n";
     } else {
@@ -423,6 +460,17 @@ WrapperCreator::create_function_wrapper(Class* _class, Function* function)
     out << "\n";
 }
 
+bool
+WrapperCreator::is_output_parameter(const Type& type)
+{
+    // non-const references to basic types are used by batch getters
+    // to hand back several values with a single call
+    return type.ref == 1 && type.pointer == 0 && !type._const &&
+        (type.atomic_type == &BasicType::INT ||
+         type.atomic_type == &BasicType::FLOAT ||
+         type.atomic_type == &BasicType::BOOL);
+}
+
 void
 WrapperCreator::prepare_argument(const Type& type, size_t index,
         const std::string& var)